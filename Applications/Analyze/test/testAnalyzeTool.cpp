@@ -448,6 +448,29 @@ void testIMUDataReporter() {
     auto elemSum = diff.colSum().rowSum().norm();
     ASSERT_EQUAL<double>(elemSum, 0.0, 1e-5);
 
+    // The parallel utility gives the same signals for any number of threads.
+    for (int numThreads : {1, 3}) {
+        SyntheticIMUSignals signals = createSyntheticIMUSignals(pendulum,
+                statesTable, controlsTable, framePaths, numThreads);
+        ASSERT(signals.linearAccelerations.getColumnLabels() == framePaths);
+        ASSERT_EQUAL<double>((signals.linearAccelerations.getMatrix() -
+                accelTableFromUtility.getMatrix()).colSum().rowSum().norm(),
+                0.0, 1e-12);
+        ASSERT_EQUAL<double>((signals.angularVelocities.getMatrix() -
+                imuDataReporter->getGyroscopeSignalsTable().getMatrix())
+                .colSum().rowSum().norm(), 0.0, 1e-5);
+        const auto& orientations = signals.orientations.getMatrix();
+        const auto& reported =
+                imuDataReporter->getOrientationsTable().getMatrix();
+        for (int row = 0; row < orientations.nrow(); ++row) {
+            for (int col = 0; col < orientations.ncol(); ++col) {
+                // q and -q represent the same rotation.
+                ASSERT_EQUAL<double>(std::abs(~orientations(row, col).asVec4() *
+                        reported(row, col).asVec4()), 1.0, 1e-7);
+            }
+        }
+    }
+
     // Now test AnalyzeTool workflow
     AnalyzeTool analyzeIMU;
     analyzeIMU.setName("dpend_imu");
@@ -42,6 +42,7 @@ void checkMarkersReferenceConsistencyFromTool(InverseKinematicsTool& ik);
 
 void testInverseKinematicsSolverWithOrientations();
 void testInverseKinematicsSolverWithEulerAnglesFromFile();
+void testIKTrialSet();
 
 int main()
 {
@@ -132,6 +133,15 @@ int main()
         failures.push_back("testInverseKinematicsScapulothoracicAbduction");
     }
 
+    try {
+        ++itc;
+        testIKTrialSet();
+        cout << "testIKTrialSet passed" << endl;
+    } catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testIKTrialSet");
+    }
+
 
     if (!failures.empty()) {
         cout << "Done, with " << failures.size() << " failure(s) out of ";
@@ -489,3 +499,69 @@ void testInverseKinematicsSolverWithEulerAnglesFromFile()
     const TimeSeriesTable standard("std_subject01_walk1_ik.mot");
     compareMotionTables(report, standard);
 }
+
+// Solve two trials (one with its own task weights) with the IKTrialSet, with
+// one thread and with several, and compare each to the same trial solved
+// on its own by the tool.
+void testIKTrialSet()
+{
+    const std::string setupFile = "subject01_Setup_InverseKinematics.xml";
+    const IKTaskSet customTasks("gait2354_IK_Tasks.xml");
+
+    // Solve each trial on its own.
+    auto solveSingleTrial = [&](const IKTaskSet* tasks,
+                                    const std::string& outputFile) {
+        InverseKinematicsTool ik(setupFile);
+        if (tasks) ik.upd_IKTaskSet() = *tasks;
+        ik.setStartTime(0.4);
+        ik.setEndTime(0.8);
+        ik.setOutputMotionFileName(outputFile);
+        ik.run();
+        return Storage(outputFile);
+    };
+    const Storage standardUniform =
+            solveSingleTrial(nullptr, "testIK_trial_uniform_single.mot");
+    const Storage standardCustom =
+            solveSingleTrial(&customTasks, "testIK_trial_custom_single.mot");
+
+    for (int numThreads : {1, 3}) {
+        InverseKinematicsTool ik(setupFile);
+        ik.set_num_parallel_threads(numThreads);
+        const std::string suffix = "_" + std::to_string(numThreads) + ".mot";
+
+        IKTrial uniform("uniform", ik.getMarkerDataFileName());
+        uniform.set_time_range(0, 0.4);
+        uniform.set_time_range(1, 0.8);
+        uniform.set_output_motion_file("testIK_trial_uniform" + suffix);
+        IKTrial custom(uniform);
+        custom.setName("custom");
+        custom.set_task_set(customTasks);
+        custom.set_output_motion_file("testIK_trial_custom" + suffix);
+        ik.getIKTrialSet().cloneAndAppend(uniform);
+        ik.getIKTrialSet().cloneAndAppend(custom);
+        ik.run();
+
+        // The trials are solved with copies of the same model, so the
+        // results should match the single-trial results closely.
+        CHECK_STORAGE_AGAINST_STANDARD(
+                Storage("testIK_trial_uniform" + suffix), standardUniform,
+                std::vector<double>(24, 1e-6), __FILE__, __LINE__,
+                "IKTrialSet uniform trial differs from a single trial.");
+        CHECK_STORAGE_AGAINST_STANDARD(
+                Storage("testIK_trial_custom" + suffix), standardCustom,
+                std::vector<double>(24, 1e-6), __FILE__, __LINE__,
+                "IKTrialSet custom trial differs from a single trial.");
+    }
+
+    // The task weights of the custom trial must actually be used.
+    double maxDifference = 0;
+    for (int i = 0; i < standardUniform.getSize(); ++i) {
+        const auto& a = standardUniform.getStateVector(i)->getData();
+        const auto& b = standardCustom.getStateVector(i)->getData();
+        for (int j = 0; j < a.getSize(); ++j) {
+            maxDifference = std::max(maxDifference, std::abs(a[j] - b[j]));
+        }
+    }
+    ASSERT(maxDifference > 1e-6, __FILE__, __LINE__,
+            "Expected custom task weights to change the IK solution.");
+}
@@ -0,0 +1,68 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  DoubleBufferView.java                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+package org.opensim.modeling;
+
+/** A view, without copying, of numbers stored by an OpenSim or Simbody object,
+such as a Vector (Vector.getDirectView()), a Matrix (Matrix.getDirectView())
+or a column of a table (TimeSeriesTable.getDependentColumnDirectView()).
+
+The view holds a reference to the object that owns the numbers, so the owner
+is not garbage-collected while the view is in use. Keep the view rather than
+the underlying buffer: the buffer alone does not keep the owner alive. The view
+becomes invalid if the owner is resized (e.g., if rows are appended to a
+table). Writing to the view changes the owner.
+*/
+public final class DoubleBufferView {
+  private final Object owner;
+  private final java.nio.DoubleBuffer buffer;
+
+  DoubleBufferView(Object owner, java.nio.ByteBuffer bytes) {
+    this.owner = owner;
+    this.buffer = bytes == null ? java.nio.DoubleBuffer.allocate(0)
+            : bytes.order(java.nio.ByteOrder.nativeOrder()).asDoubleBuffer();
+  }
+
+  /** The object that owns the numbers. */
+  public Object getOwner() { return owner; }
+
+  public int size() { return buffer.capacity(); }
+
+  public double get(int index) { return buffer.get(index); }
+
+  public void set(int index, double value) { buffer.put(index, value); }
+
+  /** Copy all of the numbers into a new array. */
+  public double[] getAsArray() {
+    double[] ret = new double[size()];
+    buffer.duplicate().get(ret);
+    return ret;
+  }
+
+  /** Copy the given array, which must have size() elements, into the view. */
+  public void setFromArray(double[] values) {
+    if (values.length != size()) {
+      throw new IllegalArgumentException(
+              "Array size does not match the view.");
+    }
+    buffer.duplicate().put(values);
+  }
+}
@@ -177,6 +177,122 @@ using namespace SimTK;
 };
 
 
+// Bulk transfer of table and Storage columns (see java_simbody.i).
+%extend OpenSim::DataTable_<double, double> {
+    void copyIndependentColumnToArray(double values[], int size) {
+        const auto& column = $self->getIndependentColumn();
+        if(size < (int)column.size())
+            throw std::out_of_range{"Array is smaller than the column."};
+
+        std::copy(column.begin(), column.end(), values);
+    }
+
+    void copyDependentColumnAtIndexToArray(int index,
+            double values[], int size) {
+        const auto column = $self->getDependentColumnAtIndex(index);
+        if(size < column.nrow())
+            throw std::out_of_range{"Array is smaller than the column."};
+
+        for(int i = 0; i < column.nrow(); ++i)
+            values[i] = column[i];
+    }
+
+    // Elements are copied in row-major order.
+    void copyMatrixToArray(double values[], int size) {
+        const auto& matrix = $self->getMatrix();
+        if(size < matrix.nelt())
+            throw std::out_of_range{"Array is smaller than the table."};
+
+        const int ncol = matrix.ncol();
+        for(int i = 0; i < matrix.nrow(); ++i)
+            for(int j = 0; j < ncol; ++j)
+                values[i * ncol + j] = matrix.getElt(i, j);
+    }
+
+    OpenSim::JavaDirectBuffer getDependentColumnDirectBufferAtIndex(
+            int index) {
+        auto column = $self->updMatrix().updCol(index);
+        if(column.nrow() == 0) return {nullptr, 0};
+        if(!column.hasContiguousData())
+            throw std::runtime_error{"Column data is not contiguous."};
+
+        return {&column[0],
+                static_cast<jlong>(sizeof(double) * column.nrow())};
+    }
+}
+
+%typemap(javacode) OpenSim::DataTable_<double, double> %{
+  public double[] getIndependentColumnAsArray() {
+      double[] ret = new double[(int)getNumRows()];
+      copyIndependentColumnToArray(ret, ret.length);
+      return ret;
+  }
+  public double[] getDependentColumnAtIndexAsArray(int index) {
+      double[] ret = new double[(int)getNumRows()];
+      copyDependentColumnAtIndexToArray(index, ret, ret.length);
+      return ret;
+  }
+  public double[] getDependentColumnAsArray(String columnLabel) {
+      return getDependentColumnAtIndexAsArray(
+              (int)getColumnIndex(columnLabel));
+  }
+  /** Get all dependent values in row-major order. */
+  public double[] getMatrixAsArray() {
+      double[] ret = new double[(int)(getNumRows() * getNumColumns())];
+      copyMatrixToArray(ret, ret.length);
+      return ret;
+  }
+  /** View a dependent column without copying it. The view keeps this table
+      alive, and is valid until rows are added to or removed from the table;
+      writes to the view change the table. */
+  public DoubleBufferView getDependentColumnDirectViewAtIndex(int index) {
+      return new DoubleBufferView(this,
+              getDependentColumnDirectBufferAtIndex(index));
+  }
+  public DoubleBufferView getDependentColumnDirectView(String columnLabel) {
+      return getDependentColumnDirectViewAtIndex(
+              (int)getColumnIndex(columnLabel));
+  }
+%}
+
+%extend OpenSim::Storage {
+    void copyTimeColumnToArray(double values[], int size) {
+        if(size < $self->getSize())
+            throw std::out_of_range{"Array is smaller than the column."};
+
+        for(int i = 0; i < $self->getSize(); ++i)
+            values[i] = $self->getStateVector(i)->getTime();
+    }
+
+    void copyDataColumnToArray(const std::string& columnName,
+            double values[], int size) {
+        const int index = $self->getStateIndex(columnName);
+        if(index < 0)
+            throw std::out_of_range{"Column '" + columnName + "' not found."};
+        if(size < $self->getSize())
+            throw std::out_of_range{"Array is smaller than the column."};
+
+        for(int i = 0; i < $self->getSize(); ++i) {
+            const OpenSim::StateVector& row = *$self->getStateVector(i);
+            values[i] = index < row.getSize() ? row.getData()[index]
+                                              : SimTK::NaN;
+        }
+    }
+}
+
+%typemap(javacode) OpenSim::Storage %{
+  public double[] getTimeColumnAsArray() {
+      double[] ret = new double[getSize()];
+      copyTimeColumnToArray(ret, ret.length);
+      return ret;
+  }
+  public double[] getDataColumnAsArray(String columnName) {
+      double[] ret = new double[getSize()];
+      copyDataColumnToArray(columnName, ret, ret.length);
+      return ret;
+  }
+%}
+
 %extend OpenSim::Object {
 	static OpenSim::Array<std::string> getFunctionClassNames() {
 		  OpenSim::Array<std::string> availableClassNames;
@@ -59,6 +59,28 @@ SWIG_JAVABODY_PROXY(public, public, SWIGTYPE)
     return $null;
 }
 
+/* Memory owned by a C++ object, returned to Java as a direct ByteBuffer (null
+   if there are no elements). The Java methods that return such memory wrap it
+   in a DoubleBufferView, which keeps the owning proxy alive.                 */
+%{
+namespace OpenSim {
+struct JavaDirectBuffer {
+    void* data;
+    jlong numBytes;
+};
+}
+%}
+%typemap(jni) OpenSim::JavaDirectBuffer "jobject"
+%typemap(jtype) OpenSim::JavaDirectBuffer "java.nio.ByteBuffer"
+%typemap(jstype) OpenSim::JavaDirectBuffer "java.nio.ByteBuffer"
+%typemap(out) OpenSim::JavaDirectBuffer %{
+    $result = $1.numBytes > 0
+            ? jenv->NewDirectByteBuffer($1.data, $1.numBytes) : NULL;
+%}
+%typemap(javaout) OpenSim::JavaDirectBuffer {
+    return $jnicall;
+}
+
 %exception {
 	  try {
 	  $action
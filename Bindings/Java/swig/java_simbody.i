@@ -101,6 +101,12 @@ public:
 
 %include exception.i
 
+/* Bulk transfer of numeric data. Each element of a SimTK container that is
+   accessed through get()/set() costs a JNI call; the methods below instead
+   move an entire vector, matrix or table column across the JNI boundary in a
+   single call. Contiguous vectors and matrices can also be viewed directly,
+   without any copy, through a DoubleBufferView (see java_preliminaries.i).   */
+
 %extend SimTK::RowVectorBase<double> {
     double get(int i) {
         if(i >= $self->nelt())
@@ -117,11 +123,33 @@ public:
     }
 }
 
+%extend SimTK::RowVectorBase<double> {
+    void copyToArray(double values[], int size) {
+        if(size < $self->nelt())
+            throw std::out_of_range{"Array is smaller than the RowVector."};
+
+        for(int i = 0; i < $self->nelt(); ++i)
+            values[i] = $self->getElt(0, i);
+    }
+
+    void copyFromArray(double values[], int size) {
+        if(size != $self->nelt())
+            throw std::out_of_range{"Array size does not match RowVector."};
+
+        for(int i = 0; i < size; ++i)
+            $self->updElt(0, i) = values[i];
+    }
+}
+
 %typemap(javacode) SimTK::RowVectorBase<double> %{
     @Override
     public double[][] getAsMat() {
-        double[][] ret = new double[1][size()];
-        for (int i = 0; i < size(); ++i) { ret[0][i] = get(i); }
+        return new double[][]{getAsArray()};
+    }
+
+    public double[] getAsArray() {
+        double[] ret = new double[size()];
+        copyToArray(ret, ret.length);
         return ret;
     }
 %}
@@ -129,7 +157,7 @@ public:
 %typemap(javacode) SimTK::RowVector_<double> %{
     public static RowVector createFromMat(double[] data) {
         RowVector v = new RowVector(data.length);
-        for (int i = 0; i < data.length; ++i) { v.set(i, data[i]); }
+        v.copyFromArray(data, data.length);
         return v;
     }
 %}
@@ -150,18 +178,63 @@ public:
      }
 }
 
+%extend SimTK::VectorBase<double> {
+    void copyToArray(double values[], int size) {
+        if(size < $self->nelt())
+            throw std::out_of_range{"Array is smaller than the Vector."};
+
+        for(int i = 0; i < $self->nelt(); ++i)
+            values[i] = $self->getElt(i, 0);
+    }
+
+    void copyFromArray(double values[], int size) {
+        if(size != $self->nelt())
+            throw std::out_of_range{"Array size does not match Vector."};
+
+        for(int i = 0; i < size; ++i)
+            $self->updElt(i, 0) = values[i];
+    }
+
+    bool hasContiguousData() const {
+        return $self->hasContiguousData();
+    }
+
+    OpenSim::JavaDirectBuffer getDirectBuffer() {
+        if($self->nelt() == 0) return {nullptr, 0};
+        if(!$self->hasContiguousData())
+            throw std::runtime_error{"Vector data is not contiguous."};
+
+        return {&$self->updElt(0, 0),
+                static_cast<jlong>(sizeof(double) * $self->nelt())};
+    }
+}
+
 %typemap(javacode) SimTK::VectorBase<double> %{
     public double[][] getAsMat() {
-        double[][] ret = new double[size()][1];
-        for (int i = 0; i < size(); ++i) { ret[i][0] = get(i); }
+        double[] values = getAsArray();
+        double[][] ret = new double[values.length][1];
+        for (int i = 0; i < values.length; ++i) { ret[i][0] = values[i]; }
+        return ret;
+    }
+
+    public double[] getAsArray() {
+        double[] ret = new double[size()];
+        copyToArray(ret, ret.length);
         return ret;
     }
+
+    /** View the elements of this Vector without copying them. The view keeps
+        this Vector alive, and is valid until this Vector is resized; writes
+        to the view change the Vector. Requires hasContiguousData(). */
+    public DoubleBufferView getDirectView() {
+        return new DoubleBufferView(this, getDirectBuffer());
+    }
 %}
 
 %typemap(javacode) SimTK::Vector_<double> %{
     public static Vector createFromMat(double[] data) {
         Vector v = new Vector(data.length, 0.0);
-        for (int i = 0; i < data.length; ++i) { v.set(i, data[i]); }
+        v.copyFromArray(data, data.length);
         return v;
     }
 %}
@@ -258,16 +331,66 @@ public:
     }
 %}
 
+%extend SimTK::MatrixBase<double> {
+    // Elements are copied in row-major order.
+    void copyToArray(double values[], int size) {
+        if(size < $self->nelt())
+            throw std::out_of_range{"Array is smaller than the Matrix."};
+
+        const int ncol = $self->ncol();
+        for(int i = 0; i < $self->nrow(); ++i)
+            for(int j = 0; j < ncol; ++j)
+                values[i * ncol + j] = $self->getElt(i, j);
+    }
+
+    // Elements are copied in row-major order.
+    void copyFromArray(double values[], int size) {
+        if(size != $self->nelt())
+            throw std::out_of_range{"Array size does not match Matrix."};
+
+        const int ncol = $self->ncol();
+        for(int i = 0; i < $self->nrow(); ++i)
+            for(int j = 0; j < ncol; ++j)
+                $self->updElt(i, j) = values[i * ncol + j];
+    }
+
+    // The elements in column-major order, which is how SimTK stores a
+    // Matrix; views of transposed or strided matrices are rejected.
+    OpenSim::JavaDirectBuffer getDirectBuffer() {
+        if($self->nelt() == 0) return {nullptr, 0};
+        double* first = &$self->updElt(0, 0);
+        if(!$self->hasContiguousData() ||
+                ($self->nrow() > 1 && &$self->updElt(1, 0) != first + 1))
+            throw std::runtime_error{
+                    "Matrix data is not contiguous in column-major order."};
+
+        return {first, static_cast<jlong>(sizeof(double) * $self->nelt())};
+    }
+}
+
 %typemap(javacode) SimTK::MatrixBase<double> %{
     public double[][] getAsMat() {
+        double[] values = getAsArray();
         double[][] ret = new double[nrow()][ncol()];
         for (int i = 0; i < nrow(); ++i) {
-            for (int j = 0; j < ncol(); ++j) {
-                ret[i][j] = getElt(i, j);
-            }
+            System.arraycopy(values, i * ncol(), ret[i], 0, ncol());
         }
         return ret;
     }
+
+    /** Get all elements in row-major order. */
+    public double[] getAsArray() {
+        double[] ret = new double[nrow() * ncol()];
+        copyToArray(ret, ret.length);
+        return ret;
+    }
+
+    /** View the elements of this Matrix, in column-major order, without
+        copying them. The view keeps this Matrix alive, and is valid until
+        this Matrix is resized; writes to the view change the Matrix. */
+    public DoubleBufferView getDirectView() {
+        return new DoubleBufferView(this, getDirectBuffer());
+    }
 %}
 
 %typemap(javacode) SimTK::Matrix_<double> %{
@@ -277,12 +400,12 @@ public:
         if (numRows > 0) {
             numCols = data[0].length;
         }
-        Matrix matrix = new Matrix(numRows, numCols);
+        double[] values = new double[numRows * numCols];
         for (int i = 0; i < numRows; ++i) {
-            for (int j = 0; j < numCols; ++j) {
-                matrix.set(i, j, data[i][j]);
-            }
+            System.arraycopy(data[i], 0, values, i * numCols, numCols);
         }
+        Matrix matrix = new Matrix(numRows, numCols);
+        matrix.copyFromArray(values, values.length);
         return matrix;
     }
 %}
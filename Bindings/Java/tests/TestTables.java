@@ -768,6 +768,69 @@ class TestTables {
         }
     }
 
+    public static void test_bulkTransfer() {
+        System.out.println("Test bulk transfer of vectors and tables.");
+        double[] data = new double[]{1.5, 2.5, 3.5, 4.5};
+        Vector vec = Vector.createFromMat(data);
+        double[] vecData = vec.getAsArray();
+        assert vecData.length == 4;
+        for(int i = 0; i < 4; ++i)
+            assert vecData[i] == data[i];
+        // A direct view shares memory with the Vector.
+        assert vec.hasContiguousData();
+        DoubleBufferView view = vec.getDirectView();
+        assert view.size() == 4;
+        assert view.get(2) == 3.5;
+        view.set(2, -1);
+        assert vec.get(2) == -1;
+        // The view keeps its owner alive.
+        assert view.getOwner() == vec;
+        vec = null;
+        System.gc();
+        assert view.get(2) == -1;
+        assert new Vector().getDirectView().size() == 0;
+
+        Matrix mat = Matrix.createFromMat(new double[][]{{1, 2, 3},
+                                                          {4, 5, 6}});
+        double[] matData = mat.getAsArray();
+        for(int i = 0; i < 6; ++i)
+            assert matData[i] == i + 1;
+        // Matrix views are in column-major order.
+        DoubleBufferView matView = mat.getDirectView();
+        assert matView.size() == 6;
+        assert matView.get(1) == 4 && matView.get(2) == 2;
+        matView.set(5, -6);
+        assert mat.get(1, 2) == -6;
+
+        TimeSeriesTable table = new TimeSeriesTable();
+        StdVectorString labels = new StdVectorString();
+        labels.add("a"); labels.add("b");
+        table.setColumnLabels(labels);
+        for(int i = 0; i < 3; ++i) {
+            RowVector row = new RowVector(2, 0);
+            row.set(0, i); row.set(1, 10 * i);
+            table.appendRow(0.1 * i, row);
+        }
+        double[] times = table.getIndependentColumnAsArray();
+        double[] colB = table.getDependentColumnAsArray("b");
+        double[] all = table.getMatrixAsArray();
+        for(int i = 0; i < 3; ++i) {
+            assert times[i] == 0.1 * i;
+            assert colB[i] == 10 * i;
+            assert all[2 * i] == i && all[2 * i + 1] == 10 * i;
+        }
+        // A column view shares memory with the table and keeps it alive.
+        DoubleBufferView colView = table.getDependentColumnDirectView("b");
+        assert colView.size() == 3;
+        colView.set(1, -10);
+        assert table.getDependentColumn("b").get(1) == -10;
+        double[] colData = colView.getAsArray();
+        assert colData[0] == 0 && colData[1] == -10 && colData[2] == 20;
+        table = null;
+        System.gc();
+        assert colView.get(2) == 20;
+    }
+
     public static void main(String[] args)  throws java.io.IOException {
         test_DataTable();
         test_DataTableVec3();
@@ -775,5 +838,6 @@ class TestTables {
         test_TimeSeriesTableVec3();
         test_FlattenWithIK();
         test_vector_rowvector();
+        test_bulkTransfer();
     }
 }
@@ -10,6 +10,7 @@
 #include <OpenSim/Tools/IKMarkerTask.h>
 #include <OpenSim/Tools/IKCoordinateTask.h>
 #include <OpenSim/Tools/IKTaskSet.h>
+#include <OpenSim/Tools/IKTrialSet.h>
 
 #include <OpenSim/Tools/MarkerPair.h>
 #include <OpenSim/Tools/MarkerPairSet.h>
@@ -1,5 +1,4 @@
-%module(package="opensim", directors="1") moco
-// %module(package="opensim", directors="1", threads="1") moco
+%module(package="opensim", directors="1", threads="1") moco
 #pragma SWIG nowarn=822,451,503,516,325
 #pragma SWIG nowarn=401
 
@@ -604,6 +603,11 @@ using namespace SimTK;
 %}
 
 
+// Release the GIL during long-running calls (see python_preliminaries.i).
+RELEASE_GIL(OpenSim::MocoStudy::solve);
+RELEASE_GIL(OpenSim::MocoTrack::solve);
+RELEASE_GIL(OpenSim::MocoInverse::solve);
+
 // Include all the OpenSim code.
 // =============================
 
@@ -25,6 +25,24 @@ own project.
 // For reference (doesn't work and should not be necessary):
 // %rename(__add__) operator+;
 
+// Threads
+// =======
+/*
+The modules are built with threads="1" so that director methods (e.g., a LogSink
+or AnalysisWrapper implemented in Python) acquire the GIL before calling into
+Python, even when C++ invokes them from a thread that does not hold it (e.g., a
+parallelFor() worker). Wrapped functions keep holding the GIL while they run,
+except for the long-running entry points listed with RELEASE_GIL in the module
+that wraps them, which release it so that other Python threads can run
+(including other OpenSim jobs, on different objects). These functions must not
+be given Python objects that another thread modifies while they run.
+*/
+%feature("nothreadallow");
+
+%define RELEASE_GIL(NAME)
+%feature("nothreadallow", "0") NAME;
+%enddef
+
 // Rename
 // ======
 %rename(NoType) OpenSim::Geometry::None;
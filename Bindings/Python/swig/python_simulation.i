@@ -1,4 +1,4 @@
-%module(package="opensim", directors="1") simulation
+%module(package="opensim", directors="1", threads="1") simulation
 #pragma SWIG nowarn=822,451,503,516,325
 // 401 is "Nothing known about base class *some-class*.
 //         Maybe you forgot to instantiate *some-template* using %template."
@@ -137,6 +137,13 @@ MODEL_ADOPT_HELPER(Controller);
 
 %unique_ptr(OpenSim::PositionMotion);
 
+// Release the GIL during long-running calls (see python_preliminaries.i).
+RELEASE_GIL(OpenSim::Manager::integrate);
+RELEASE_GIL(OpenSim::simulate);
+RELEASE_GIL(OpenSim::createSyntheticIMUAccelerationSignals);
+RELEASE_GIL(OpenSim::createSyntheticIMUSignals);
+RELEASE_GIL(OpenSim::createProducedForcesTable);
+
 // Include all the OpenSim code.
 // =============================
 %include <Bindings/preliminaries.i>
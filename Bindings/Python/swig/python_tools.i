@@ -1,4 +1,4 @@
-%module(package="opensim", directors="1") tools
+%module(package="opensim", directors="1", threads="1") tools
 #pragma SWIG nowarn=822,451,503,516,325
 // 401 is "Nothing known about base class *some-class*.
 //         Maybe you forgot to instantiate *some-template* using %template."
@@ -49,6 +49,18 @@ using namespace SimTK;
 // None.
 
 
+// Release the GIL during long-running calls (see python_preliminaries.i).
+RELEASE_GIL(OpenSim::Tool::run);
+RELEASE_GIL(OpenSim::DynamicsTool::run);
+RELEASE_GIL(OpenSim::InverseDynamicsTool::run);
+RELEASE_GIL(OpenSim::InverseKinematicsTool::run);
+RELEASE_GIL(OpenSim::IMUInverseKinematicsTool::run);
+RELEASE_GIL(OpenSim::AnalyzeTool::run);
+RELEASE_GIL(OpenSim::ForwardTool::run);
+RELEASE_GIL(OpenSim::CMCTool::run);
+RELEASE_GIL(OpenSim::RRATool::run);
+RELEASE_GIL(OpenSim::ScaleTool::run);
+
 %pythonappend OpenSim::ModelScaler::addScale %{
     aScale._markAdopted()
 %}
@@ -0,0 +1,85 @@
+"""
+Long-running calls (e.g., Manager.integrate() and Tool.run()) release the GIL,
+so that Python threads can run OpenSim jobs concurrently.
+"""
+
+import os
+import threading
+import unittest
+
+import opensim as osim
+
+test_dir = os.path.join(os.path.dirname(os.path.abspath(osim.__file__)),
+                        'tests')
+
+# Silence warning messages if mesh (.vtp) files cannot be found.
+osim.Model.setDebugLevel(0)
+
+
+def integrate_arm26(final_time):
+    model = osim.Model(os.path.join(test_dir, "arm26.osim"))
+    state = model.initSystem()
+    manager = osim.Manager(model)
+    state.setTime(0)
+    manager.initialize(state)
+    state = manager.integrate(final_time)
+    return [state.getY().get(i) for i in range(state.getNY())]
+
+
+class PythonLogSink(osim.LogSink):
+    def __init__(self):
+        super(PythonLogSink, self).__init__()
+        self.messages = []
+
+    def sinkImpl(self, msg):
+        self.messages.append(msg)
+
+
+class TestThreads(unittest.TestCase):
+    def test_concurrent_integrate(self):
+        final_time = 0.05
+        expected = integrate_arm26(final_time)
+
+        results = [None] * 3
+        errors = []
+        def job(i):
+            try:
+                results[i] = integrate_arm26(final_time)
+            except Exception as e:
+                errors.append(e)
+        threads = [threading.Thread(target=job, args=(i,))
+                   for i in range(len(results))]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        self.assertEqual(errors, [])
+        for result in results:
+            self.assertEqual(len(result), len(expected))
+            for value, expected_value in zip(result, expected):
+                self.assertAlmostEqual(value, expected_value, places=10)
+
+    def test_python_log_sink_in_worker_thread(self):
+        # The tool logs to a sink implemented in Python while it runs without
+        # the GIL in a worker thread.
+        sink = PythonLogSink()
+        osim.Logger.addSink(sink)
+        try:
+            def job():
+                model = osim.Model(os.path.join(test_dir, "arm26.osim"))
+                forward = osim.ForwardTool()
+                forward.setModel(model)
+                forward.setName('test_threads_arm26')
+                forward.setFinalTime(0.01)
+                forward.run()
+            thread = threading.Thread(target=job)
+            thread.start()
+            thread.join()
+        finally:
+            osim.Logger.removeSink(sink)
+        self.assertTrue(len(sink.messages) > 0)
+
+
+if __name__ == '__main__':
+    unittest.main()
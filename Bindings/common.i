@@ -60,6 +60,7 @@
 %include <OpenSim/Common/Sine.h>
 %include <OpenSim/Common/PolynomialFunction.h>
 %include <OpenSim/Common/MultivariatePolynomialFunction.h>
+%include <OpenSim/Common/MultivariateBSplineFunction.h>
 %include <OpenSim/Common/ExpressionBasedFunction.h>
 
 %include <OpenSim/Common/SmoothSegmentedFunctionFactory.h>
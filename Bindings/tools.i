@@ -6,6 +6,9 @@
 %include <OpenSim/Tools/IKMarkerTask.h>
 %include <OpenSim/Tools/IKCoordinateTask.h>
 %include <OpenSim/Tools/IKTaskSet.h>
+%include <OpenSim/Tools/IKTrial.h>
+%template(SetIKTrials) OpenSim::Set<OpenSim::IKTrial, OpenSim::Object>;
+%include <OpenSim/Tools/IKTrialSet.h>
 %include <OpenSim/Tools/MarkerPair.h>
 %template(SetMarkerPairs) OpenSim::Set<OpenSim::MarkerPair, OpenSim::Object>;
 %include <OpenSim/Tools/MarkerPairSet.h>
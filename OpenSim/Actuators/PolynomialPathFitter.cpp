@@ -27,7 +27,9 @@
 #include <OpenSim/Actuators/ModelOperators.h>
 
 #include <OpenSim/Common/LatinHypercubeDesign.h>
+#include <OpenSim/Common/MultivariateBSplineFunction.h>
 #include <OpenSim/Common/MultivariatePolynomialFunction.h>
+#include <OpenSim/Common/Parallel.h>
 #include <OpenSim/Common/STOFileAdapter.h>
 #include <OpenSim/Common/IO.h>
 #include <OpenSim/Simulation/Control/PrescribedController.h>
@@ -223,6 +225,37 @@ void PolynomialPathFitter::run() {
     log_info("Use stepwise regression = {}",
             get_use_stepwise_regression() ? "true" : "false");
 
+    // Path function type.
+    checkPropertyValueIsInSet(getProperty_path_function_type(),
+            {"polynomial", "bspline"});
+    log_info("Path function type = '{}'", get_path_function_type());
+    if (get_path_function_type() == "bspline") {
+        OPENSIM_THROW_IF_FRMOBJ(get_use_stepwise_regression(), Exception,
+                "Stepwise regression is not supported with the 'bspline' "
+                "path function type.")
+        OPENSIM_THROW_IF_FRMOBJ(get_include_moment_arm_functions() ||
+                                get_include_lengthening_speed_function(),
+                Exception,
+                "Moment arm and lengthening speed functions are not "
+                "supported with the 'bspline' path function type.")
+        checkPropertyValueIsPositive(getProperty_minimum_bspline_intervals());
+        checkPropertyValueIsPositive(getProperty_maximum_bspline_intervals());
+        OPENSIM_THROW_IF_FRMOBJ(get_minimum_bspline_intervals() >
+                                get_maximum_bspline_intervals(), Exception,
+                "Expected 'minimum_bspline_intervals' to be less than or "
+                "equal to 'maximum_bspline_intervals', but received {} and "
+                "{}, respectively.", get_minimum_bspline_intervals(),
+                get_maximum_bspline_intervals())
+        OPENSIM_THROW_IF_FRMOBJ(get_bspline_smoothing() < 0, Exception,
+                "Expected 'bspline_smoothing' to be non-negative, but "
+                "received {}.", get_bspline_smoothing())
+        log_info("Minimum B-spline intervals = {}",
+                get_minimum_bspline_intervals());
+        log_info("Maximum B-spline intervals = {}",
+                get_maximum_bspline_intervals());
+        log_info("B-spline smoothing = {:1.1e}", get_bspline_smoothing());
+    }
+
     // Output directory.
     std::string outputDir = get_output_directory();
     if (outputDir.empty()) {
@@ -322,6 +355,16 @@ void PolynomialPathFitter::run() {
     log_info(separator);
     for (int i = 0; i < functionBasedPaths.getSize(); ++i) {
         auto path = functionBasedPaths.get(pathNames[i]);
+        if (const auto* bspline =
+                    dynamic_cast<const MultivariateBSplineFunction*>(
+                            &path.getLengthFunction())) {
+            line = fmt::format("{:{}} | intervals = {}, dimension = "
+                    "{}, coefficients = {}", path.getName(), longestPathName,
+                    bspline->getNumIntervals(), bspline->getDimension(),
+                    bspline->getCoefficients().size());
+            log_info(line);
+            continue;
+        }
         auto function = dynamic_cast<const MultivariatePolynomialFunction&>(
                 path.getLengthFunction());
         SimTK::Vector coefficients = function.getCoefficients();
@@ -753,29 +796,22 @@ void PolynomialPathFitter::computePathLengthsAndMomentArms(
     };
 
     // Divide the path length and moment arm computations across multiple
-    // threads.
+    // threads. Each chunk of time points writes only its own output, so the
+    // assembled tables do not depend on thread scheduling.
     int stride = static_cast<int>(
             std::floor(coordinateValues.getNumRows() / numThreads));
-    std::vector<std::future<SimTK::Matrix>> futures;
-    int offset = 0;
-    for (int thread = 0; thread < numThreads; ++thread) {
-        auto begin_iter = statesTrajectory.begin() + offset;
-        auto end_iter = (thread == numThreads-1) ?
-                statesTrajectory.end() :
-                statesTrajectory.begin() + offset + stride;
-        futures.push_back(std::async(std::launch::async,
-                calcPathLengthsAndMomentArmsSubset,
-                model, thread,
-                makeIteratorRange(begin_iter, end_iter)));
-        offset += stride;
-    }
-
-    // Wait for threads to finish and collect results
-    std::vector<SimTK::Matrix> outputs;
-    outputs.reserve(numThreads);
-    for (int i = 0; i < numThreads; ++i) {
-        outputs.push_back(futures[i].get());
-    }
+    std::vector<SimTK::Matrix> outputs(numThreads);
+    parallelForChunks(numThreads,
+            [&](int thread) {
+                auto begin_iter = statesTrajectory.begin() + thread * stride;
+                auto end_iter = (thread == numThreads-1) ?
+                        statesTrajectory.end() :
+                        begin_iter + stride;
+                outputs[thread] = calcPathLengthsAndMomentArmsSubset(
+                        model, thread,
+                        makeIteratorRange(begin_iter, end_iter));
+            },
+            numThreads);
 
     // Assemble results into one TimeSeriesTable
     std::vector<double> times = coordinateValues.getIndependentColumn();
@@ -1009,6 +1045,22 @@ Set<FunctionBasedPath> PolynomialPathFitter::fitPolynomialCoefficients(
                 }
             }
 
+            auto functionBasedPath = make_unique<FunctionBasedPath>();
+            functionBasedPath->setName(forcePath);
+            functionBasedPath->setCoordinatePaths(coordinatePathsThisForce);
+
+            // B-spline fitting.
+            // -----------------
+            if (get_path_function_type() == "bspline") {
+                MultivariateBSplineFunction lengthFunction;
+                fitBSplineCoefficients(coordinatesThisForce, b,
+                        get_minimum_bspline_intervals(),
+                        get_maximum_bspline_intervals(), lengthFunction);
+                functionBasedPath->setLengthFunction(lengthFunction);
+                thesePaths.push_back(std::move(functionBasedPath));
+                continue;
+            }
+
             // Polynomial fitting.
             // -------------------
             SimTK::Vector coefficients;
@@ -1029,9 +1081,6 @@ Set<FunctionBasedPath> PolynomialPathFitter::fitPolynomialCoefficients(
             lengthFunction.setDimension(numCoordinatesThisForce);
             lengthFunction.setOrder(order);
             lengthFunction.setCoefficients(coefficients);
-            auto functionBasedPath = make_unique<FunctionBasedPath>();
-            functionBasedPath->setName(forcePath);
-            functionBasedPath->setCoordinatePaths(coordinatePathsThisForce);
             functionBasedPath->setLengthFunction(lengthFunction);
             if (getIncludeMomentArmFunctions()) {
                 for (int iq = 0; iq < numCoordinatesThisForce; ++iq) {
@@ -1191,6 +1240,38 @@ std::string PolynomialPathFitter::getLatinHypercubeAlgorithm() const {
     return get_latin_hypercube_algorithm();
 }
 
+void PolynomialPathFitter::setPathFunctionType(std::string type) {
+    set_path_function_type(std::move(type));
+}
+
+std::string PolynomialPathFitter::getPathFunctionType() const {
+    return get_path_function_type();
+}
+
+void PolynomialPathFitter::setMinimumBSplineIntervals(int numIntervals) {
+    set_minimum_bspline_intervals(numIntervals);
+}
+
+int PolynomialPathFitter::getMinimumBSplineIntervals() const {
+    return get_minimum_bspline_intervals();
+}
+
+void PolynomialPathFitter::setMaximumBSplineIntervals(int numIntervals) {
+    set_maximum_bspline_intervals(numIntervals);
+}
+
+int PolynomialPathFitter::getMaximumBSplineIntervals() const {
+    return get_maximum_bspline_intervals();
+}
+
+void PolynomialPathFitter::setBSplineSmoothing(double smoothing) {
+    set_bspline_smoothing(smoothing);
+}
+
+double PolynomialPathFitter::getBSplineSmoothing() const {
+    return get_bspline_smoothing();
+}
+
 //=============================================================================
 // HELPER FUNCTIONS
 //=============================================================================
@@ -1347,6 +1428,221 @@ int PolynomialPathFitter::fitAllCoefficients(
     return order;
 }
 
+int PolynomialPathFitter::fitBSplineCoefficients(
+        const SimTK::Matrix& coordinates, const SimTK::Vector& b,
+        int minIntervals, int maxIntervals,
+        MultivariateBSplineFunction& function) const {
+
+    const int numTimes = coordinates.nrow();
+    const int numCoordinates = coordinates.ncol();
+    const int numRows = numTimes * (numCoordinates + 1);
+    OPENSIM_THROW_IF_FRMOBJ(
+            numCoordinates > MultivariateBSplineFunction::getMaxDimension(),
+            Exception,
+            "B-spline path functions support at most {} coordinates, but a "
+            "path depends on {} coordinates.",
+            MultivariateBSplineFunction::getMaxDimension(), numCoordinates)
+
+    // The domain of the B-spline spans the sampled coordinate values.
+    SimTK::Array_<SimTK::Vector> points(numTimes);
+    for (int itime = 0; itime < numTimes; ++itime) {
+        points[itime] = coordinates.row(itime).getAsVector();
+    }
+    SimTK::Vector lowerBounds(numCoordinates);
+    SimTK::Vector upperBounds(numCoordinates);
+    for (int ic = 0; ic < numCoordinates; ++ic) {
+        double lower = SimTK::Infinity;
+        double upper = -SimTK::Infinity;
+        for (int itime = 0; itime < numTimes; ++itime) {
+            lower = std::min(lower, coordinates(itime, ic));
+            upper = std::max(upper, coordinates(itime, ic));
+        }
+        if (upper - lower < SimTK::SignificantReal) {
+            lower -= 0.5;
+            upper += 0.5;
+        }
+        lowerBounds[ic] = lower;
+        upperBounds[ic] = upper;
+    }
+
+    // Rows of the fitting matrix are cached if they fit in a modest amount of
+    // memory; otherwise, they are recomputed in each conjugate gradient
+    // iteration.
+    int numTerms = 1;
+    for (int ic = 0; ic < numCoordinates; ++ic) numTerms *= 4;
+    const bool cacheRows =
+            static_cast<long long>(numRows) * numTerms <= (1LL << 22);
+
+    int numIntervals = minIntervals;
+    SimTK::Vector coefficients;
+    while (true) {
+        MultivariateBSplineFunction basis;
+        basis.setBounds(lowerBounds, upperBounds);
+        basis.setNumIntervals(numIntervals);
+        const int numBasis = numIntervals + 3;
+        const int numCoefficients = basis.getNumCoefficients();
+        basis.setCoefficients(SimTK::Vector(numCoefficients, 0.0));
+
+        // Row 'row' of A holds the weights of the coefficients contributing
+        // to a path length (first numTimes rows) or to a moment arm (the
+        // negated partial derivative of the path length).
+        std::vector<int> rowIndices;
+        SimTK::Vector rowWeights;
+        std::vector<int> cachedIndices;
+        std::vector<double> cachedWeights;
+        auto computeRow = [&](int row) {
+            const int derivComponent = row / numTimes - 1;
+            basis.getCoefficientWeights(points[row % numTimes],
+                    derivComponent, rowIndices, rowWeights);
+            if (derivComponent >= 0) rowWeights *= -1.0;
+        };
+        if (cacheRows) {
+            cachedIndices.reserve(static_cast<size_t>(numRows) * numTerms);
+            cachedWeights.reserve(static_cast<size_t>(numRows) * numTerms);
+            for (int row = 0; row < numRows; ++row) {
+                computeRow(row);
+                for (int k = 0; k < numTerms; ++k) {
+                    cachedIndices.push_back(rowIndices[k]);
+                    cachedWeights.push_back(rowWeights[k]);
+                }
+            }
+        }
+        // Call func(indices, weights) for each row of A.
+        auto forEachRow = [&](const std::function<void(int, const int*,
+                                      const double*)>& func) {
+            for (int row = 0; row < numRows; ++row) {
+                if (cacheRows) {
+                    const size_t offset = static_cast<size_t>(row) * numTerms;
+                    func(row, &cachedIndices[offset], &cachedWeights[offset]);
+                } else {
+                    computeRow(row);
+                    func(row, rowIndices.data(), &rowWeights[0]);
+                }
+            }
+        };
+
+        // Second-difference smoothing penalty along each coordinate.
+        std::vector<int> strides(numCoordinates);
+        int stride = 1;
+        for (int ic = numCoordinates - 1; ic >= 0; --ic) {
+            strides[ic] = stride;
+            stride *= numBasis;
+        }
+        const double smoothing = get_bspline_smoothing();
+        // y += smoothing * sum_j D_j^T D_j x.
+        auto applySmoothing = [&](const SimTK::Vector& x, SimTK::Vector& y) {
+            if (smoothing == 0) return;
+            for (int ic = 0; ic < numCoordinates; ++ic) {
+                const int s = strides[ic];
+                for (int i = 0; i < numCoefficients; ++i) {
+                    const int k = (i / s) % numBasis;
+                    if (k == 0 || k == numBasis - 1) continue;
+                    const double r =
+                            smoothing * (x[i - s] - 2.0 * x[i] + x[i + s]);
+                    y[i - s] += r;
+                    y[i] -= 2.0 * r;
+                    y[i + s] += r;
+                }
+            }
+        };
+
+        // Normal equations: (A^T A / numRows + penalty) x = A^T b / numRows.
+        SimTK::Vector rhs(numCoefficients, 0.0);
+        SimTK::Vector diagonal(numCoefficients, 0.0);
+        forEachRow([&](int row, const int* indices, const double* weights) {
+            for (int k = 0; k < numTerms; ++k) {
+                rhs[indices[k]] += weights[k] * b[row] / numRows;
+                diagonal[indices[k]] += weights[k] * weights[k] / numRows;
+            }
+        });
+        for (int ic = 0; ic < numCoordinates; ++ic) {
+            const int s = strides[ic];
+            for (int i = 0; i < numCoefficients; ++i) {
+                const int k = (i / s) % numBasis;
+                if (k == 0 || k == numBasis - 1) continue;
+                diagonal[i - s] += smoothing;
+                diagonal[i] += 4.0 * smoothing;
+                diagonal[i + s] += smoothing;
+            }
+        }
+        for (int i = 0; i < numCoefficients; ++i) {
+            if (diagonal[i] <= 0) diagonal[i] = 1.0;
+        }
+        auto applyNormalMatrix = [&](const SimTK::Vector& x,
+                                         SimTK::Vector& y) {
+            y = 0;
+            forEachRow([&](int, const int* indices, const double* weights) {
+                double value = 0;
+                for (int k = 0; k < numTerms; ++k) {
+                    value += weights[k] * x[indices[k]];
+                }
+                value /= numRows;
+                for (int k = 0; k < numTerms; ++k) {
+                    y[indices[k]] += value * weights[k];
+                }
+            });
+            applySmoothing(x, y);
+        };
+
+        // Jacobi-preconditioned conjugate gradient.
+        coefficients.resize(numCoefficients);
+        coefficients = 0;
+        SimTK::Vector residual = rhs;
+        SimTK::Vector z(numCoefficients);
+        for (int i = 0; i < numCoefficients; ++i) {
+            z[i] = residual[i] / diagonal[i];
+        }
+        SimTK::Vector direction = z;
+        SimTK::Vector product(numCoefficients);
+        double rz = ~residual * z;
+        const double tolerance = 1e-10 * rhs.norm();
+        const int maxIterations = std::min(2 * numCoefficients, 2000);
+        for (int iter = 0; iter < maxIterations; ++iter) {
+            if (residual.norm() <= tolerance) break;
+            applyNormalMatrix(direction, product);
+            const double alpha = rz / (~direction * product);
+            coefficients += alpha * direction;
+            residual -= alpha * product;
+            for (int i = 0; i < numCoefficients; ++i) {
+                z[i] = residual[i] / diagonal[i];
+            }
+            const double rzNext = ~residual * z;
+            direction = z + (rzNext / rz) * direction;
+            rz = rzNext;
+        }
+
+        // Calculate the RMS errors.
+        SimTK::Vector errorSumSqr(numCoordinates + 1, 0.0);
+        forEachRow([&](int row, const int* indices, const double* weights) {
+            double fitted = 0;
+            for (int k = 0; k < numTerms; ++k) {
+                fitted += weights[k] * coefficients[indices[k]];
+            }
+            errorSumSqr[row / numTimes] += SimTK::square(b[row] - fitted);
+        });
+        bool pathLengthMet = std::sqrt(errorSumSqr[0] / numTimes) <
+                             get_path_length_tolerance();
+        bool momentArmMet = true;
+        for (int ic = 0; ic < numCoordinates; ++ic) {
+            if (std::sqrt(errorSumSqr[ic + 1] / numTimes) >
+                    get_moment_arm_tolerance()) {
+                momentArmMet = false;
+                break;
+            }
+        }
+
+        if ((pathLengthMet && momentArmMet) || numIntervals == maxIntervals) {
+            break;
+        }
+        ++numIntervals;
+    }
+
+    function.setBounds(lowerBounds, upperBounds);
+    function.setNumIntervals(numIntervals);
+    function.setCoefficients(coefficients);
+    return numIntervals;
+}
+
 void PolynomialPathFitter::fitCoefficientsStepwiseRegression(
         const SimTK::Matrix& coordinates, const SimTK::Vector& b, int order,
         SimTK::Vector& coefficients) const {
@@ -1609,6 +1905,10 @@ void PolynomialPathFitter::constructProperties() {
     constructProperty_latin_hypercube_algorithm("random");
     constructProperty_include_moment_arm_functions(false);
     constructProperty_include_lengthening_speed_function(false);
+    constructProperty_path_function_type("polynomial");
+    constructProperty_minimum_bspline_intervals(2);
+    constructProperty_maximum_bspline_intervals(6);
+    constructProperty_bspline_smoothing(1e-8);
 }
 
 std::string PolynomialPathFitter::getDocumentDirectory() const {
@@ -23,6 +23,7 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 
+#include <OpenSim/Common/MultivariateBSplineFunction.h>
 #include <OpenSim/Simulation/TableProcessor.h>
 #include <OpenSim/Actuators/ModelProcessor.h>
 #include <OpenSim/Simulation/Model/FunctionBasedPath.h>
@@ -93,7 +94,10 @@ private:
  * The `setNumParallelThreads` method specifies the number of threads used to
  * parallelize the path fitting process. The `setLatinHypercubeAlgorithm` method
  * specifies the Latin hypercube sampling algorithm used to sample coordinate
- * values for path fitting.
+ * values for path fitting. The `setPathFunctionType` method selects whether
+ * paths are fitted with polynomials or with tensor-product B-splines
+ * (`MultivariateBSplineFunction`), which are cheaper to evaluate for paths
+ * that depend on many coordinates.
  *
  * The default settings are as follows:
  *
@@ -107,6 +111,7 @@ private:
  *    - Number of threads: number of available hardware threads
  *    - Latin hypercube sampling algorithm: "random"
  *    - Use stepwise regression: False
+ *    - Path function type: "polynomial"
  *
  * @note The default settings were chosen based on testing with a human
  *       lower-extremity model. Different settings may be required for other
@@ -484,6 +489,58 @@ public:
         return get_include_lengthening_speed_function();
     }
 
+    /**
+     * The type of function used to approximate each path length: "polynomial"
+     * (default) for a `MultivariatePolynomialFunction`, or "bspline" for a
+     * `MultivariateBSplineFunction`.
+     *
+     * A tensor-product B-spline is a piecewise cubic polynomial defined on a
+     * uniform grid spanning the sampled range of each coordinate. Its
+     * evaluation cost depends only on the number of coordinates (4^Nc
+     * terms), not on the resolution of the grid, and, unlike a high-order
+     * polynomial, it does not oscillate near the edges of the sampled range.
+     * The number of grid intervals per coordinate is increased, starting from
+     * the minimum number of intervals, until the path length and moment arm
+     * tolerances are met or the maximum number of intervals is reached (see
+     * `setMinimumBSplineIntervals()` and `setMaximumBSplineIntervals()`).
+     *
+     * @note The "bspline" function type cannot be combined with stepwise
+     *       regression, moment arm functions, or lengthening speed functions.
+     *       FunctionBasedPath computes moment arms from the derivatives of the
+     *       B-spline, which are exact.
+     */
+    void setPathFunctionType(std::string type);
+    /// @copydoc setPathFunctionType()
+    std::string getPathFunctionType() const;
+
+    /**
+     * The minimum and maximum number of intervals into which the sampled
+     * range of each coordinate is divided when fitting a B-spline path
+     * function (defaults: 2 and 6). Only used when the path function type is
+     * "bspline" (see `setPathFunctionType()`).
+     */
+    void setMinimumBSplineIntervals(int numIntervals);
+    /// @copydoc setMinimumBSplineIntervals()
+    int getMinimumBSplineIntervals() const;
+    /// @copydoc setMinimumBSplineIntervals()
+    void setMaximumBSplineIntervals(int numIntervals);
+    /// @copydoc setMinimumBSplineIntervals()
+    int getMaximumBSplineIntervals() const;
+
+    /**
+     * The weight on the penalty on the second differences of the B-spline
+     * coefficients, relative to the mean squared error between the sampled
+     * and fitted path lengths and moment arms (default: 1e-8).
+     *
+     * The penalty keeps the fit smooth, and determines the coefficients of
+     * grid cells that contain few or no samples. Increase this value if the
+     * fitted paths are noisy between samples; decrease it if the fit is too
+     * smooth to meet the tolerances.
+     */
+    void setBSplineSmoothing(double smoothing);
+    /// @copydoc setBSplineSmoothing()
+    double getBSplineSmoothing() const;
+
     // HELPER FUNCTIONS
     /**
      * Print out a summary of the path fitting results, including information
@@ -564,6 +621,18 @@ private:
     OpenSim_DECLARE_PROPERTY(include_lengthening_speed_function, bool,
             "Whether or not to include the lengthening speed function in the "
             "fitted path (default: false).");
+    OpenSim_DECLARE_PROPERTY(path_function_type, std::string,
+            "The type of function used to approximate each path length: "
+            "'polynomial' or 'bspline' (default: 'polynomial').");
+    OpenSim_DECLARE_PROPERTY(minimum_bspline_intervals, int,
+            "The minimum number of intervals per coordinate for a B-spline "
+            "path function (default: 2).");
+    OpenSim_DECLARE_PROPERTY(maximum_bspline_intervals, int,
+            "The maximum number of intervals per coordinate for a B-spline "
+            "path function (default: 6).");
+    OpenSim_DECLARE_PROPERTY(bspline_smoothing, double,
+            "The weight on the penalty on the second differences of the "
+            "B-spline coefficients (default: 1e-8).");
 
     void constructProperties();
 
@@ -680,6 +749,23 @@ private:
             const SimTK::Vector& b, int minOrder, int maxOrder,
             SimTK::Vector& coefficients) const;
 
+    /**
+     * Fit a `MultivariateBSplineFunction` to the path length and moment arm
+     * samples. The arguments are the same as for `fitAllCoefficients()`; the
+     * domain of the B-spline spans the range of the sampled coordinate values.
+     *
+     * The number of intervals per coordinate is increased from `minIntervals`
+     * until the RMS errors are within the tolerances or `maxIntervals` is
+     * reached, and the number of intervals used is returned. For each number
+     * of intervals, we minimize the mean squared error of `Ax = b` plus the
+     * smoothing penalty with the preconditioned conjugate gradient method on
+     * the normal equations. Each row of `A` has only 4^Nc nonzero entries, so
+     * `A` is never formed explicitly.
+     */
+    int fitBSplineCoefficients(const SimTK::Matrix& coordinates,
+            const SimTK::Vector& b, int minIntervals, int maxIntervals,
+            MultivariateBSplineFunction& function) const;
+
     /**
      * Fit to the path length and moment arm samples using stepwise regression
      * to find a minimal set of polynomial coefficients. `coordinates` is the
@@ -26,6 +26,7 @@
 #include <catch2/catch_all.hpp>
 
 #include <OpenSim/Actuators/DeGrooteFregly2016Muscle.h>
+#include <OpenSim/Common/MultivariateBSplineFunction.h>
 #include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
 #include <OpenSim/Common/CommonUtilities.h>
 
@@ -57,8 +58,10 @@ namespace {
         return processor;
     }
 
-    TableProcessor createCoordinatesTable(bool correctLabel, bool addMetaData) {
+    TableProcessor createCoordinatesTable(bool correctLabel, bool addMetaData,
+            double offset = 0.0) {
         SimTK::Vector column = SimTK::Test::randVector(100);
+        column += offset;
         std::vector<double> times;
         times.reserve(column.size());
         for (int i = 0; i < column.size(); ++i) {
@@ -129,4 +132,97 @@ TEST_CASE("Invalid configurations") {
         REQUIRE_THROWS_WITH(fitter.run(), ContainsSubstring(
             "Expected 'maximum_polynomial_order' to be at most 9"));
     }
+
+    SECTION("B-spline intervals") {
+        fitter.setPathFunctionType("bspline");
+        fitter.setMinimumBSplineIntervals(5);
+        fitter.setMaximumBSplineIntervals(4);
+        REQUIRE_THROWS_WITH(fitter.run(), ContainsSubstring(
+            "Expected 'minimum_bspline_intervals' to be less than or equal"));
+    }
+
+    SECTION("B-spline smoothing") {
+        fitter.setPathFunctionType("bspline");
+        fitter.setBSplineSmoothing(-1.0);
+        REQUIRE_THROWS_WITH(fitter.run(), ContainsSubstring(
+            "Expected 'bspline_smoothing' to be non-negative"));
+    }
+
+    SECTION("B-spline with stepwise regression") {
+        fitter.setPathFunctionType("bspline");
+        fitter.setUseStepwiseRegression(true);
+        REQUIRE_THROWS_WITH(fitter.run(), ContainsSubstring(
+            "Stepwise regression is not supported with the 'bspline'"));
+    }
+}
+
+TEST_CASE("B-spline path functions") {
+    // The coordinate values stay away from zero, where the path length of the
+    // hanging muscle, |height|, has a kink.
+    PolynomialPathFitter fitter;
+    fitter.setModel(createHangingMuscleModel());
+    fitter.setCoordinateValues(createCoordinatesTable(true, true, 3.0));
+    fitter.setPathFunctionType("bspline");
+
+    const double tolerance = 1e-4;
+
+    auto checkFit = [&](const std::string& outputDir, int expectedIntervals) {
+        fitter.setOutputDirectory(outputDir);
+        fitter.run();
+
+        Set<FunctionBasedPath> paths(
+                outputDir + "/hanging_muscle_FunctionBasedPathSet.xml");
+        REQUIRE(paths.getSize() == 1);
+        const auto* function = dynamic_cast<const MultivariateBSplineFunction*>(
+                &paths.get(0).getLengthFunction());
+        REQUIRE(function != nullptr);
+        CHECK(function->getDimension() == 1);
+        CHECK(function->getNumIntervals() == expectedIntervals);
+
+        // RMS errors over the sampled coordinate values.
+        auto calcMaxRMSError = [&](const std::string& name) {
+            TimeSeriesTable original(
+                    fmt::format("{}/hanging_muscle_{}_sampled.sto",
+                            outputDir, name));
+            TimeSeriesTable fitted(
+                    fmt::format("{}/hanging_muscle_{}_sampled_fitted.sto",
+                            outputDir, name));
+            REQUIRE(fitted.getNumColumns() > 0);
+            REQUIRE(original.getNumRows() == fitted.getNumRows());
+            double maxError = 0;
+            for (const auto& label : fitted.getColumnLabels()) {
+                const SimTK::Vector error =
+                        original.getDependentColumn(label) -
+                        fitted.getDependentColumn(label);
+                maxError = std::max(maxError,
+                        std::sqrt(error.normSqr() / error.size()));
+            }
+            return maxError;
+        };
+        CHECK(calcMaxRMSError("path_lengths") < tolerance);
+        CHECK(calcMaxRMSError("moment_arms") < tolerance);
+    };
+
+    SECTION("Minimum intervals meet the tolerances") {
+        // The path length is linear in the coordinate, which a cubic B-spline
+        // reproduces with any number of intervals.
+        fitter.setMinimumBSplineIntervals(2);
+        fitter.setMaximumBSplineIntervals(5);
+        checkFit("testPolynomialPathFitter_bspline_minimum", 2);
+    }
+
+    SECTION("Equal minimum and maximum intervals") {
+        fitter.setMinimumBSplineIntervals(4);
+        fitter.setMaximumBSplineIntervals(4);
+        fitter.setBSplineSmoothing(0);
+        checkFit("testPolynomialPathFitter_bspline_fixed", 4);
+    }
+
+    SECTION("Maximum intervals end the search") {
+        // A path length tolerance of zero can never be met.
+        fitter.setPathLengthTolerance(0);
+        fitter.setMinimumBSplineIntervals(1);
+        fitter.setMaximumBSplineIntervals(3);
+        checkFit("testPolynomialPathFitter_bspline_maximum", 3);
+    }
 }
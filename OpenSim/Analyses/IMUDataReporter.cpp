@@ -26,6 +26,7 @@
 // INCLUDES
 //=============================================================================
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/Parallel.h>
 #include <OpenSim/Common/STOFileAdapter.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Analyses/IMUDataReporter.h>
@@ -33,9 +34,17 @@
 #include <OpenSim/Simulation/StatesTrajectory.h>
 #include <OpenSim/Simulation/OpenSense/OpenSenseUtilities.h>
 #include <OpenSim/Simulation/PositionMotion.h>
+
+#include <algorithm>
 using namespace OpenSim;
 using namespace std;
 
+namespace {
+    // Copying and initializing a model for a block of states is only worth
+    // it if the block contains at least this many states.
+    constexpr int MinStatesPerBlock = 32;
+}
+
 //=============================================================================
 // CONSTRUCTOR(S) AND DESTRUCTOR
 //=============================================================================
@@ -104,7 +113,6 @@ void IMUDataReporter::setNull()
 
     setName("IMUDataReporter");
     _modelLocal = nullptr;
-    // ReferencePtr members are initialized to null by construction
 }
 //_____________________________________________________________________________
 //=============================================================================
@@ -119,17 +127,101 @@ record(const SimTK::State& s)
 {
     if(_modelLocal == nullptr) return -1;
 
-    // Set model to whatever defaults have been updated to from the last iteration
-    SimTK::State& sWorkingCopy = _modelLocal->updWorkingState();
-    sWorkingCopy.setTime(s.getTime());
+    // The signals are computed in computePendingSignals().
+    _pendingTimes.push_back(s.getTime());
+    _pendingQ.push_back(s.getQ());
+    _pendingU.push_back(s.getU());
+
+    return 0;
+}
+//_____________________________________________________________________________
+/**
+ * Compute the signals of the states buffered by record(), in parallel blocks
+ * of consecutive states, and append them to the output tables.
+ */
+void IMUDataReporter::computePendingSignals() const
+{
+    const int numStates = static_cast<int>(_pendingTimes.size());
+    if (numStates == 0) return;
 
-    // update Q's and U's
-    sWorkingCopy.setQ(s.getQ());
-    sWorkingCopy.setU(s.getU());
+    const bool reportOrientations = get_report_orientations();
+    const bool reportGyroscope = get_report_gyroscope_signals();
+    const bool reportAccelerometer = get_report_accelerometer_signals();
+    const SimTK::Stage stage = reportAccelerometer
+            ? SimTK::Stage::Acceleration
+            : (reportGyroscope ? SimTK::Stage::Velocity
+                               : SimTK::Stage::Position);
+    const int numIMUs = static_cast<int>(
+            _modelLocal->getComponentList<IMU>().countComponents());
 
-    _modelLocal->realizeReport(sWorkingCopy);
+    // The first block uses _modelLocal; the others use copies of it, which
+    // are made serially.
+    const int numBlocks = std::max(1,
+            std::min(ThreadPool::getDefault().getNumThreads(),
+                    numStates / MinStatesPerBlock));
+    std::vector<std::unique_ptr<Model>> modelCopies;
+    for (int block = 1; block < numBlocks; ++block) {
+        modelCopies.emplace_back(new Model(*_modelLocal));
+    }
 
-    return 0;
+    SimTK::Matrix_<SimTK::Quaternion> orientations(numStates, numIMUs);
+    SimTK::Matrix_<SimTK::Vec3> angularVelocities(numStates, numIMUs);
+    SimTK::Matrix_<SimTK::Vec3> linearAccelerations(numStates, numIMUs);
+    parallelForChunks(numBlocks, [&](int block) {
+        Model& model = block == 0 ? *_modelLocal : *modelCopies[block - 1];
+        SimTK::State& state = block == 0 ? model.updWorkingState()
+                                         : model.initSystem();
+        if (block != 0 && get_compute_accelerations_without_forces()) {
+            model.getComponent<PositionMotion>("position_motion")
+                    .setEnabled(state, true);
+        }
+        std::vector<const IMU*> imus;
+        for (const auto& imu : model.getComponentList<IMU>()) {
+            imus.push_back(&imu);
+        }
+
+        const int begin = static_cast<int>(
+                static_cast<long long>(numStates) * block / numBlocks);
+        const int end = static_cast<int>(
+                static_cast<long long>(numStates) * (block + 1) / numBlocks);
+        for (int i = begin; i < end; ++i) {
+            state.setTime(_pendingTimes[i]);
+            state.setQ(_pendingQ[i]);
+            state.setU(_pendingU[i]);
+            model.getSystem().realize(state, stage);
+            for (int j = 0; j < numIMUs; ++j) {
+                if (reportOrientations) {
+                    orientations(i, j) =
+                            imus[j]->calcOrientationAsQuaternion(state);
+                }
+                if (reportGyroscope) {
+                    angularVelocities(i, j) =
+                            imus[j]->calcGyroscopeSignal(state);
+                }
+                if (reportAccelerometer) {
+                    linearAccelerations(i, j) =
+                            imus[j]->calcAccelerometerSignal(state);
+                }
+            }
+        }
+    });
+
+    for (int i = 0; i < numStates; ++i) {
+        if (reportOrientations) {
+            _orientationsTable.appendRow(_pendingTimes[i], orientations[i]);
+        }
+        if (reportGyroscope) {
+            _angularVelocityTable.appendRow(
+                    _pendingTimes[i], angularVelocities[i]);
+        }
+        if (reportAccelerometer) {
+            _linearAccelerationsTable.appendRow(
+                    _pendingTimes[i], linearAccelerations[i]);
+        }
+    }
+    _pendingTimes.clear();
+    _pendingQ.clear();
+    _pendingU.clear();
 }
 //_____________________________________________________________________________
 /**
@@ -150,13 +242,9 @@ int IMUDataReporter::begin(const SimTK::State& s)
         "IMUDataReporter: model not provided.");
 
     _modelLocal.reset(_model->clone());
-
-    _orientationsReporter = new TableReporter_<SimTK::Quaternion>();
-    _orientationsReporter->setName("OrientationsReporter");
-    _angularVelocityReporter = new TableReporter_<SimTK::Vec3>();
-    _angularVelocityReporter->setName("AngularVelocityReporter");
-    _linearAccelerationsReporter = new TableReporter_<SimTK::Vec3>();
-    _linearAccelerationsReporter->setName("LinearAccelerationsReporter");
+    _pendingTimes.clear();
+    _pendingQ.clear();
+    _pendingU.clear();
 
     if (getProperty_frame_paths().size() > 0) {
         std::vector<std::string> paths_string;
@@ -167,21 +255,19 @@ int IMUDataReporter::begin(const SimTK::State& s)
     }
 
     _modelLocal->initSystem();
+    std::vector<std::string> imuNames;
     for (const auto& comp : _modelLocal->getComponentList<IMU>()) {
-        if (get_report_orientations())
-            _orientationsReporter->addToReport(
-                comp.getOutput("orientation_as_quaternion"), comp.getName());
-        if (get_report_gyroscope_signals())
-            _angularVelocityReporter->addToReport(
-                comp.getOutput("gyroscope_signal"), comp.getName());
-        if (get_report_accelerometer_signals())
-            _linearAccelerationsReporter->addToReport(
-                comp.getOutput("accelerometer_signal"), comp.getName());
+        imuNames.push_back(comp.getName());
     }
-
-    _modelLocal->addComponent(_orientationsReporter.get());
-    _modelLocal->addComponent(_angularVelocityReporter.get());
-    _modelLocal->addComponent(_linearAccelerationsReporter.get());
+    _orientationsTable = TimeSeriesTable_<SimTK::Quaternion>();
+    _angularVelocityTable = TimeSeriesTable_<SimTK::Vec3>();
+    _linearAccelerationsTable = TimeSeriesTable_<SimTK::Vec3>();
+    if (get_report_orientations())
+        _orientationsTable.setColumnLabels(imuNames);
+    if (get_report_gyroscope_signals())
+        _angularVelocityTable.setColumnLabels(imuNames);
+    if (get_report_accelerometer_signals())
+        _linearAccelerationsTable.setColumnLabels(imuNames);
 
     if (get_compute_accelerations_without_forces()) {
         OPENSIM_THROW_IF_FRMOBJ(_statesStore == nullptr, Exception,
@@ -247,6 +333,7 @@ int IMUDataReporter::end( const SimTK::State& s)
     if(!proceed()) return(0);
 
     record(s);
+    computePendingSignals();
 
     return(0);
 }
@@ -274,20 +361,21 @@ int IMUDataReporter::
 printResults(const string &aBaseName,const string &aDir,double aDT,
                  const string &aExtension)
 {
+    computePendingSignals();
     {
         IO::CwdChanger cwd = IO::CwdChanger::changeTo(aDir);
         if (get_report_orientations()) {
-            auto& rotationsTable = _orientationsReporter->getTable();
+            auto& rotationsTable = _orientationsTable;
             STOFileAdapter_<SimTK::Quaternion>::write(
                     rotationsTable, aBaseName + "_" + "orientations.sto");
         }
         if (get_report_gyroscope_signals()) {
-            auto& angVelTable = _angularVelocityReporter->getTable();
+            auto& angVelTable = _angularVelocityTable;
             STOFileAdapter_<SimTK::Vec3>::write(
                     angVelTable, aBaseName + "_" + "angular_velocity.sto");
         }
         if (get_report_accelerometer_signals()) {
-            auto& linAccTable = _linearAccelerationsReporter->getTable();
+            auto& linAccTable = _linearAccelerationsTable;
             STOFileAdapter_<SimTK::Vec3>::write(
                     linAccTable, aBaseName + "_" + "linear_accelerations.sto");
         }
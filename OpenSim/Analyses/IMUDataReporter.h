@@ -60,6 +60,11 @@ namespace OpenSim {
  * compute any quantities near the beginning or end of the time range in your
  * data, since spline derivatives can be inaccurate in these regions.
  *
+ * The signals are not computed as each state is recorded. Instead, the
+ * recorded states are buffered and their signals are computed in one batch,
+ * in parallel contiguous blocks of states, each using its own copy of the
+ * model, when the analysis ends or when the tables or results are requested.
+ *
  * @author Ayman Habib
  * @version 1.0
  */
@@ -87,9 +92,15 @@ public:
 //=============================================================================
 private:
     /** Output tables. */
-    SimTK::ReferencePtr<TableReporter_<SimTK::Quaternion>> _orientationsReporter;
-    SimTK::ReferencePtr<TableReporter_<SimTK::Vec3>> _angularVelocityReporter;
-    SimTK::ReferencePtr<TableReporter_<SimTK::Vec3>> _linearAccelerationsReporter;
+    mutable TimeSeriesTable_<SimTK::Quaternion> _orientationsTable;
+    mutable TimeSeriesTable_<SimTK::Vec3> _angularVelocityTable;
+    mutable TimeSeriesTable_<SimTK::Vec3> _linearAccelerationsTable;
+
+    /** Times, generalized coordinates, and generalized speeds of the
+    recorded states whose signals have not been computed yet. */
+    mutable std::vector<double> _pendingTimes;
+    mutable std::vector<SimTK::Vector> _pendingQ;
+    mutable std::vector<SimTK::Vector> _pendingU;
 
     SimTK::ResetOnCopy<std::unique_ptr<Model>> _modelLocal;
     //=============================================================================
@@ -105,15 +116,18 @@ public:
     // In memory access to IMU data as Tables (Orientations)
     const TimeSeriesTable_<SimTK::Quaternion_<double> >&
     getOrientationsTable() const {
-        return _orientationsReporter->getTable();
+        computePendingSignals();
+        return _orientationsTable;
     }
     // In memory access to IMU data as Tables Angular Velocities)
     const TimeSeriesTable_<SimTK::Vec3>& getGyroscopeSignalsTable() const {
-        return _angularVelocityReporter->getTable();
+        computePendingSignals();
+        return _angularVelocityTable;
     }
     // In memory access to IMU data as Tables (Linear Accelerations)
     const TimeSeriesTable_<SimTK::Vec3>& getAccelerometerSignalsTable() const {
-        return _linearAccelerationsReporter->getTable();
+        computePendingSignals();
+        return _linearAccelerationsTable;
     }
 
 public:
@@ -142,6 +156,10 @@ public:
         double aDT=-1.0,const std::string &aExtension=".sto") override;
 
 private:
+    /** Compute the signals of the buffered states and append them to the
+    output tables. */
+    void computePendingSignals() const;
+
     void constructProperties() {
         constructProperty_report_orientations(true);
         constructProperty_report_gyroscope_signals(true);
@@ -25,6 +25,24 @@
 
 namespace OpenSim {
 
+AbstractDataTable::AbstractDataTable(const AbstractDataTable& other) :
+    _tableMetaData(other._tableMetaData),
+    _dependentsMetaData(other._dependentsMetaData),
+    _independentMetaData(other._independentMetaData),
+    _columnIndexMap(std::atomic_load(&other._columnIndexMap)) {}
+
+AbstractDataTable&
+AbstractDataTable::operator=(const AbstractDataTable& other) {
+    if (this != &other) {
+        _tableMetaData = other._tableMetaData;
+        _dependentsMetaData = other._dependentsMetaData;
+        _independentMetaData = other._independentMetaData;
+        std::atomic_store(&_columnIndexMap,
+                std::atomic_load(&other._columnIndexMap));
+    }
+    return *this;
+}
+
 size_t AbstractDataTable::getNumRows() const {
     return implementGetNumRows();
 }
@@ -73,12 +91,14 @@ AbstractDataTable::getDependentsMetaData() const {
 void 
 AbstractDataTable::setDependentsMetaData(const DependentsMetaData& 
                                          dependentsMetaData) {
+    invalidateColumnIndexMap();
     _dependentsMetaData = dependentsMetaData;
     validateDependentsMetaData();
 }
 
 void
 AbstractDataTable::removeDependentsMetaDataForKey(const std::string& key) {
+    if (key == "labels") invalidateColumnIndexMap();
     _dependentsMetaData.removeValueForKey(key);
 }
 
@@ -150,13 +170,11 @@ AbstractDataTable::getColumnIndex(const std::string& columnLabel) const {
     OPENSIM_THROW_IF(!hasColumnLabels(),
                      NoColumnLabels);
 
-    const auto& absArray = 
-        _dependentsMetaData.getValueArrayForKey("labels");
-    for(size_t i = 0; i < absArray.size(); ++i)
-        if(absArray[i].getValue<std::string>() == columnLabel)
-            return i;
+    const auto columnIndexMap = getColumnIndexMap();
+    const auto it = columnIndexMap->find(columnLabel);
+    OPENSIM_THROW_IF(it == columnIndexMap->end(), KeyNotFound, columnLabel);
 
-    OPENSIM_THROW(KeyNotFound, columnLabel);
+    return it->second;
 }
 
 bool 
@@ -164,13 +182,8 @@ AbstractDataTable::hasColumn(const std::string& columnLabel) const {
     OPENSIM_THROW_IF(!hasColumnLabels(),
                      NoColumnLabels);
 
-    const auto& absArray = 
-        _dependentsMetaData.getValueArrayForKey("labels");
-    for(size_t i = 0; i < absArray.size(); ++i)
-        if(absArray[i].getValue<std::string>() == columnLabel)
-            return true;
-
-    return false;
+    const auto columnIndexMap = getColumnIndexMap();
+    return columnIndexMap->find(columnLabel) != columnIndexMap->end();
 }
 
 bool 
@@ -183,8 +196,34 @@ AbstractDataTable::appendColumnLabel(const std::string& columnLabel) {
     auto& absArray = _dependentsMetaData.updValueArrayForKey("labels");
     auto& labels = static_cast<ValueArray<std::string>&>(absArray);
     labels.upd().push_back(SimTK::Value<std::string>{columnLabel});
+    invalidateColumnIndexMap();
 
     validateDependentsMetaData();
 }
 
+void
+AbstractDataTable::invalidateColumnIndexMap() {
+    std::atomic_store(&_columnIndexMap,
+            std::shared_ptr<const ColumnIndexMap>());
+}
+
+std::shared_ptr<const AbstractDataTable::ColumnIndexMap>
+AbstractDataTable::getColumnIndexMap() const {
+    auto columnIndexMap = std::atomic_load(&_columnIndexMap);
+    if (columnIndexMap) return columnIndexMap;
+
+    // Two threads may build the map at the same time; they build identical
+    // maps, so it does not matter which one is kept.
+    const auto& absArray =
+        _dependentsMetaData.getValueArrayForKey("labels");
+    auto newMap = std::make_shared<ColumnIndexMap>();
+    newMap->reserve(absArray.size());
+    for(size_t i = 0; i < absArray.size(); ++i)
+        newMap->emplace(absArray[i].getValue<std::string>(), i);
+
+    columnIndexMap = std::move(newMap);
+    std::atomic_store(&_columnIndexMap, columnIndexMap);
+    return columnIndexMap;
+}
+
 } // namespace OpenSim
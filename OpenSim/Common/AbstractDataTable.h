@@ -32,7 +32,9 @@ provide an in-memory container for data access and manipulation.              */
 #include "OpenSim/Common/Exception.h"
 #include "OpenSim/Common/ValueArrayDictionary.h"
 
+#include <memory>
 #include <ostream>
+#include <unordered_map>
 
 namespace OpenSim {
 
@@ -180,9 +182,9 @@ public:
     typedef ValueArrayDictionary IndependentMetaData;
 
     AbstractDataTable()                                      = default;
-    AbstractDataTable(const AbstractDataTable&)              = default;
+    AbstractDataTable(const AbstractDataTable&);
     AbstractDataTable(AbstractDataTable&&)                   = default;
-    AbstractDataTable& operator=(const AbstractDataTable&)   = default;
+    AbstractDataTable& operator=(const AbstractDataTable&);
     AbstractDataTable& operator=(AbstractDataTable&&)        = default;
     virtual std::shared_ptr<AbstractDataTable> clone() const = 0;
     virtual ~AbstractDataTable()                             = default;
@@ -392,6 +394,7 @@ public:
         for(auto it = first; it != last; ++it)
             labels.upd().push_back(SimTK::Value<std::string>(*it));
 
+        invalidateColumnIndexMap();
         _dependentsMetaData.removeValueArrayForKey("labels");
         _dependentsMetaData.setValueArrayForKey("labels", labels);
         try {
@@ -483,9 +486,26 @@ protected:
     classes.                                                                  */
     virtual void validateDependentsMetaData() const  = 0;
 
+    /** Discard the cached map from column labels to column indices. Call
+    this after modifying the "labels" entry of _dependentsMetaData directly.  */
+    void invalidateColumnIndexMap();
+
     TableMetaData       _tableMetaData;
     DependentsMetaData  _dependentsMetaData;
     IndependentMetaData _independentMetaData;
+
+private:
+    typedef std::unordered_map<std::string, size_t> ColumnIndexMap;
+
+    /** Get the map from column labels to column indices, building it from the
+    "labels" metadata if necessary. For duplicate labels, the map holds the
+    index of the first column with that label.                               */
+    std::shared_ptr<const ColumnIndexMap> getColumnIndexMap() const;
+
+    // Built lazily by getColumnIndexMap() and never modified afterwards, so
+    // copies of the table can share it. Access it only with std::atomic_load
+    // and std::atomic_store so that concurrent const lookups are safe.
+    mutable std::shared_ptr<const ColumnIndexMap> _columnIndexMap;
 }; // AbstractDataTable
 
 } // namespace OpenSim
@@ -27,11 +27,23 @@
 #include "OpenSim/Common/IO.h"
 #include "XMLDocument.h"
 #include <unordered_map>
+#include <mutex>
 #include <set>
 #include <regex>
 
 using namespace SimTK;
 
+namespace {
+    // Generations of cached absolute paths (see
+    // Component::getAbsolutePathStringRef()). They start at 1 so that 0 is
+    // never a valid generation.
+    std::atomic<unsigned long long> nextPathGeneration{1};
+
+    // Serializes filling the cached absolute paths, which may happen in
+    // const methods that are called from multiple threads.
+    std::mutex absolutePathMutex;
+}
+
 namespace OpenSim {
 
 //==============================================================================
@@ -613,12 +625,13 @@ getModelingOptionNames() const {
 
     Array<std::string> moNames = getModelingOptionNamesAddedByComponent();
 
+    const std::string& thisPathName = getAbsolutePathStringRef();
     for (int i = 0; i < moNames.size(); ++i) {
-        moNames[i] = (getAbsolutePathString() + "/" + moNames[i]);
+        moNames[i] = (thisPathName + "/" + moNames[i]);
     }
 
     for (auto& comp : getComponentList<Component>()) {
-        const std::string& pathName = comp.getAbsolutePathString();
+        const std::string& pathName = comp.getAbsolutePathStringRef();
         Array<std::string> subMONames =
             comp.getModelingOptionNamesAddedByComponent();
         for (int i = 0; i < subMONames.size(); ++i) {
@@ -789,24 +802,71 @@ void Component::setOwner(const Component& owner)
         return;
     }
 
+    // The paths of this Component and its descendants change, in both the
+    // old tree and the new one.
+    invalidateTreePaths();
     _owner.reset(&owner);
+    invalidateTreePaths();
+}
+
+void Component::handleNameChange()
+{
+    invalidateTreePaths();
+}
+
+unsigned long long Component::getTreePathGeneration() const
+{
+    auto& generation = getRoot()._treePathGeneration.value;
+    unsigned long long current = generation.load(std::memory_order_acquire);
+    if (current == 0) {
+        const unsigned long long fresh = nextPathGeneration.fetch_add(1);
+        // Another thread may have assigned a generation first, in which case
+        // current is updated to it.
+        if (generation.compare_exchange_strong(
+                    current, fresh, std::memory_order_acq_rel)) {
+            current = fresh;
+        }
+    }
+    return current;
+}
+
+void Component::invalidateTreePaths() const
+{
+    getRoot()._treePathGeneration.value.store(
+            nextPathGeneration.fetch_add(1), std::memory_order_release);
 }
 
 std::string Component::getAbsolutePathString() const
 {
-    if (!hasOwner()) return "/";
-    std::string absPathName("/" + getName());
+    return getAbsolutePathStringRef();
+}
 
-    const Component* up = this;
+const std::string& Component::getAbsolutePathStringRef() const
+{
+    static const std::string rootPath("/");
+    if (!hasOwner()) return rootPath;
 
-    while (up && up->hasOwner()) {
-        up = &up->getOwner();
-        if (up->hasOwner())
-            absPathName.insert(0, "/" + up->getName());
+    const unsigned long long generation = getTreePathGeneration();
+    if (_absolutePathGeneration.value.load(std::memory_order_acquire) ==
+            generation) {
+        return _absolutePathString;
     }
 
-    return absPathName;
-
+    // Extend the (cached) path of the owner.
+    const std::string& ownerPath = getOwner().getAbsolutePathStringRef();
+    std::lock_guard<std::mutex> lock(absolutePathMutex);
+    if (_absolutePathGeneration.value.load(std::memory_order_acquire) !=
+            generation) {
+        std::string& path = _absolutePathString;
+        path.clear();
+        path.reserve(ownerPath.size() + 1 + getName().size());
+        if (ownerPath.size() > 1) path += ownerPath;
+        path += '/';
+        path += getName();
+        _absolutePathGeneration.value.store(
+                generation, std::memory_order_release);
+    }
+    return _absolutePathString;
 }
 
 ComponentPath Component::getAbsolutePath() const
@@ -881,12 +941,13 @@ Array<std::string> Component::getStateVariableNames() const
 
     Array<std::string> stateNames = getStateVariableNamesAddedByComponent();
 
+    const std::string& thisPathName = getAbsolutePathStringRef();
     for (int i = 0; i < stateNames.size(); ++i) {
-        stateNames[i] = (getAbsolutePathString() + "/" + stateNames[i]);
+        stateNames[i] = (thisPathName + "/" + stateNames[i]);
     }
 
     for (auto& comp : getComponentList<Component>()) {
-        const std::string& pathName = comp.getAbsolutePathString();
+        const std::string& pathName = comp.getAbsolutePathStringRef();
         Array<std::string> subStateNames =
             comp.getStateVariableNamesAddedByComponent();
         for (int i = 0; i < subStateNames.size(); ++i) {
@@ -1132,12 +1193,13 @@ Array<std::string> Component::getDiscreteVariableNames() const {
 
     Array<std::string> dvNames = getDiscreteVariableNamesAddedByComponent();
 
+    const std::string& thisPathName = getAbsolutePathStringRef();
     for (int i = 0; i < dvNames.size(); ++i) {
-        dvNames[i] = (getAbsolutePathString() + "/" + dvNames[i]);
+        dvNames[i] = (thisPathName + "/" + dvNames[i]);
     }
 
     for (auto& comp : getComponentList<Component>()) {
-        const std::string& pathName = comp.getAbsolutePathString();
+        const std::string& pathName = comp.getAbsolutePathStringRef();
         Array<std::string> subDVNames =
             comp.getDiscreteVariableNamesAddedByComponent();
         for (int i = 0; i < subDVNames.size(); ++i) {
@@ -1443,8 +1505,8 @@ void Component::markAsPropertySubcomponent(const Component* component)
             SimTK::ReferencePtr<Component>(const_cast<Component*>(component)));
     }
     else{
-        auto compPath = component->getAbsolutePathString();
-        auto foundPath = it->get()->getAbsolutePathString();
+        const auto& compPath = component->getAbsolutePathStringRef();
+        const auto& foundPath = it->get()->getAbsolutePathStringRef();
         OPENSIM_THROW( ComponentAlreadyPartOfOwnershipTree,
                        component->getName(), getName());
     }
@@ -1563,6 +1625,16 @@ getStateVariableSystemIndex(const std::string& stateVariableName) const
     return yix;
 }
 
+SimTK::SystemYIndex Component::getStateVariableSystemIndex(
+        const SimTK::State& state, const std::string& path) const
+{
+    OPENSIM_THROW_IF_FRMOBJ(!hasSystem(), ComponentHasNoSystem);
+    const StateVariable* sv = traverseToStateVariable(path);
+    OPENSIM_THROW_IF_FRMOBJ(!sv, Exception,
+            "State variable '{}' not found.", path);
+    return sv->findSystemYIndex(state);
+}
+
 
 void
 Component::
@@ -1857,6 +1929,16 @@ void Component::AddedStateVariable::
     getOwner().setCacheVariableValue<double>(state, derivativeName(getName()), deriv);
 }
 
+SimTK::SystemYIndex Component::AddedStateVariable::
+    findSystemYIndex(const SimTK::State& state) const
+{
+    if (!getSubsysIndex().isValid() || getVarIndex() < 0) {
+        return SimTK::SystemYIndex();
+    }
+    return SimTK::SystemYIndex(state.getZStart() +
+            state.getZStart(getSubsysIndex()) + getVarIndex());
+}
+
 
 void Component::printSocketInfo() const {
     std::string str = fmt::format("Sockets for component {} of type [{}] along "
@@ -51,6 +51,7 @@
 #include "OpenSim/Common/ComponentSocket.h"
 #include "OpenSim/Common/Object.h"
 #include "simbody/internal/MultibodySystem.h"
+#include <atomic>
 #include <unordered_map>
 
 #include <OpenSim/Common/osimCommonDLL.h>
@@ -747,11 +748,20 @@ public:
      * Component, which is the root of the tree to which this Component belongs.
      * For example: a Coordinate Component would have an absolute path name
      * like: `/arm26/elbow_r/flexion`. Accessing a Component by its
-     * absolutePathName from root is guaranteed to be unique. The
-     * absolutePathName is generated on-the-fly by traversing the ownership tree
-     * and, therefore, calling this method is not "free". */
+     * absolutePathName from root is guaranteed to be unique. This returns a
+     * copy of getAbsolutePathStringRef(). */
     std::string getAbsolutePathString() const;
 
+    /** Same as getAbsolutePathString(), but returns a reference to a path
+     * that is cached in this Component, to avoid copying it. The path is
+     * built the first time it is requested (from the cached path of the
+     * owner) and is rebuilt only after a Component in the same tree is
+     * renamed or changes owner. The reference remains valid as long as this
+     * Component exists, but its value changes if that happens. Looking up a
+     * cached path only walks the owners up to the root (without touching any
+     * strings), so this is cheap enough to call repeatedly. */
+    const std::string& getAbsolutePathStringRef() const;
+
     /** Return a ComponentPath of the absolute path of this Component.
      * Note that this has more overhead than calling `getName()` because
      * it traverses up the tree to generate the absolute pathname (and its
@@ -3363,6 +3373,18 @@ protected:
     SimTK::SystemYIndex
         getStateVariableSystemIndex(const std::string& stateVariableName) const;
 
+   /**
+     * Get the index in the State's Y vector of the state variable at the
+     * given path (e.g., as returned by getStateVariableNames()). The index is
+     * invalid if the value of the state variable is not stored directly in Y;
+     * use getStateVariableValue() for such state variables. The State must be
+     * realized to SimTK::Stage::Model.
+     * @param state   a State of this Component's System
+     * @param path    the path of the state variable of interest
+     */
+    SimTK::SystemYIndex getStateVariableSystemIndex(const SimTK::State& state,
+            const std::string& path) const;
+
 
    /**
      * Get the indexes for a Component's discrete variable. This method is
@@ -3483,13 +3505,14 @@ public:
 
         ComponentList<const C> compsList = this->template getComponentList<C>();
 
+        // if a child of this Component, one should not need
+        // to specify this Component's absolute path name
+        const std::string& thisAbsPathString = getAbsolutePathStringRef();
+        const std::string thisAbsPathPlusSubname =
+                (thisAbsPathString.size() > 1 ? thisAbsPathString : "") +
+                "/" + subname;
         for (const C& comp : compsList) {
-            // if a child of this Component, one should not need
-            // to specify this Component's absolute path name
-            ComponentPath compAbsPath = comp.getAbsolutePath();
-            ComponentPath thisAbsPathPlusSubname = getAbsolutePath();
-            thisAbsPathPlusSubname.pushBack(subname);
-            if (compAbsPath == thisAbsPathPlusSubname) {
+            if (comp.getAbsolutePathStringRef() == thisAbsPathPlusSubname) {
                 foundCs.push_back(&comp);
                 break;
             }
@@ -3985,6 +4008,13 @@ protected:
         // The derivative a state should be a cache entry and thus does not
         // change the state
         virtual void setDerivative(const SimTK::State& state, double deriv) const = 0;
+        // The index of the variable in the State's Y vector, or an invalid
+        // index if its value is not stored directly in Y. The State must be
+        // realized to SimTK::Stage::Model.
+        virtual SimTK::SystemYIndex findSystemYIndex(
+                const SimTK::State& state) const {
+            return SimTK::SystemYIndex();
+        }
 
     private:
         std::string name;
@@ -4038,13 +4068,44 @@ protected:
     void updateFromXMLNode(SimTK::Xml::Element& node, int versionNumber)
             override;
 
+    /// Invalidate the absolute paths cached in the tree of this Component.
+    void handleNameChange() override;
+
 private:
+    // An atomic counter that is reset to 0 (never a valid generation) when
+    // its Component is copied or assigned, so that copies never reuse the
+    // cached paths of the original.
+    struct PathGeneration {
+        PathGeneration() = default;
+        PathGeneration(const PathGeneration&) {}
+        PathGeneration& operator=(const PathGeneration&) {
+            value.store(0, std::memory_order_relaxed);
+            return *this;
+        }
+        std::atomic<unsigned long long> value{0};
+    };
+
+    // The generation of the paths cached in the tree of which this Component
+    // is the root, assigned on first use. It is replaced by a value that is
+    // unique in the process whenever a Component in the tree is renamed or
+    // changes owner.
+    unsigned long long getTreePathGeneration() const;
+    // Give the root of this Component's tree a new path generation.
+    void invalidateTreePaths() const;
 
     // Reference to the owning Component of this Component. It is not the
     // previous in the tree, but is the Component one level up that owns this
     // one.
     SimTK::ReferencePtr<const Component> _owner;
 
+    // The absolute path of this Component, cached by
+    // getAbsolutePathStringRef(). It is current while _absolutePathGeneration
+    // equals the path generation of the root.
+    mutable SimTK::ResetOnCopy<std::string> _absolutePathString;
+    mutable PathGeneration _absolutePathGeneration;
+    // Only used while this Component is a root (see getTreePathGeneration()).
+    mutable PathGeneration _treePathGeneration;
+
     // Reference pointer to the successor of the current Component in Pre-order traversal
     mutable SimTK::ReferencePtr<const Component> _nextComponent;
 
@@ -4143,6 +4204,8 @@ private:
 
         double getDerivative(const SimTK::State& state) const override;
         void setDerivative(const SimTK::State& state, double deriv) const override;
+        SimTK::SystemYIndex findSystemYIndex(
+                const SimTK::State& state) const override;
 
         private: // DATA
         // Changes in state variables trigger recalculation of appropriate cache
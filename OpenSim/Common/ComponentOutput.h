@@ -355,7 +355,7 @@ public:
         return getOutput().getName() + ":" + _channelName;
     }
     std::string getPathName() const override {
-        return getOutput().getOwner().getAbsolutePathString() + "|" + getName();
+        return getOutput().getOwner().getAbsolutePathStringRef() + "|" + getName();
     }
 private:
     mutable T _result;
@@ -979,13 +979,7 @@ public:
     \throws KeyNotFound If the independent column has no entry with the given
     value.                                                */
     void removeColumn(const std::string& columnLabel) {
-        const auto& labels = getColumnLabels();
-        auto iter = std::find(labels.cbegin(), labels.cend(), columnLabel);
-
-        OPENSIM_THROW_IF(iter == labels.cend(),
-            KeyNotFound, columnLabel);
-
-        return removeColumnAtIndex(std::distance(labels.cbegin(), iter));
+        return removeColumnAtIndex(getColumnIndex(columnLabel));
     }
 
     /** Get dependent column at index.
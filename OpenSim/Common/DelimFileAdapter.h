@@ -28,10 +28,13 @@
 #include "FileAdapter.h"
 #include "TimeSeriesTable.h"
 #include "OpenSim/Common/IO.h"
+#include "OpenSim/Common/Parallel.h"
 
-#include <string>
+#include <algorithm>
 #include <fstream>
 #include <regex>
+#include <sstream>
+#include <string>
 
 namespace OpenSim {
 
@@ -135,6 +138,15 @@ protected:
                           const T& elem,
                           const unsigned& prec) const;
 
+    /** Format the rows [begin, end) of the table (time followed by the
+    elements of each row) into a string, using `prec` significant digits. Only
+    the stream local to this call is used for formatting, so blocks of rows can
+    be formatted concurrently.                                                */
+    std::string formatRows(const TimeSeriesTable_<T>& table,
+                           size_t begin,
+                           size_t end,
+                           unsigned prec) const;
+
 private:
     /** Following overloads implement dataTypeName().                         */
     static inline std::string dataTypeName_impl(double);
@@ -623,19 +635,52 @@ DelimFileAdapter<T>::extendWrite(const InputTables& absTables,
                       template getValue<std::string>();
     out_stream << "\n";
 
-    // Data rows.
-    for(unsigned row = 0; row < table->getNumRows(); ++row) {
-        constexpr auto prec = std::numeric_limits<double>::digits10 + 1;
-        out_stream << std::setprecision(prec)
-                   << table->getIndependentColumn()[row];
-        const auto& row_r = table->getRowAtIndex(row);
-        for(unsigned col = 0; col < table->getNumColumns(); ++col) {
+    // Data rows. Formatting numbers dominates the cost of writing, so blocks
+    // of rows are formatted into strings on the thread pool, and the strings
+    // are then written to the file in order. Only one batch of blocks (one per
+    // thread) is held in memory at a time. The precision belongs to this call;
+    // no global formatting state is consulted.
+    constexpr int prec = std::numeric_limits<double>::digits10 + 1;
+    constexpr int blockSize = 1024;
+    const int numRows = static_cast<int>(table->getNumRows());
+    const int numBlocks = (numRows + blockSize - 1) / blockSize;
+    const int batchSize =
+            std::max(1, ThreadPool::getDefault().getNumThreads());
+    std::vector<std::string> blocks;
+    for (int firstBlock = 0; firstBlock < numBlocks;
+            firstBlock += batchSize) {
+        const int numInBatch = std::min(batchSize, numBlocks - firstBlock);
+        blocks.assign(numInBatch, std::string());
+        parallelForChunks(numInBatch, [&](int iblock) {
+            const int begin = (firstBlock + iblock) * blockSize;
+            const int end = std::min(begin + blockSize, numRows);
+            blocks[iblock] = formatRows(*table, begin, end, prec);
+        });
+        for (const auto& block : blocks) {
+            out_stream << block;
+        }
+    }
+}
+
+template<typename T>
+std::string
+DelimFileAdapter<T>::formatRows(const TimeSeriesTable_<T>& table,
+                                size_t begin,
+                                size_t end,
+                                unsigned prec) const {
+    std::ostringstream stream;
+    for(size_t row = begin; row < end; ++row) {
+        stream << std::setprecision(prec)
+               << table.getIndependentColumn()[row];
+        const auto& row_r = table.getRowAtIndex(row);
+        for(unsigned col = 0; col < table.getNumColumns(); ++col) {
             const auto& elt = row_r[col];
-            out_stream << _delimiterWrite;
-            writeElem(out_stream, elt, prec);
+            stream << _delimiterWrite;
+            writeElem(stream, elt, prec);
         }
-        out_stream << "\n";
+        stream << "\n";
     }
+    return stream.str();
 }
 
 template<typename T>
@@ -32,6 +32,7 @@
 #include "Logger.h"
 #include <climits>
 #include <math.h>
+#include <mutex>
 #include <string>
 #include <time.h>
 #if defined(__linux__) || defined(__APPLE__)
@@ -58,13 +59,14 @@ using namespace OpenSim;
 using namespace std;
 
 // STATICS
-bool IO::_Scientific = false;
-bool IO::_GFormatForDoubleOutput = false;
-int IO::_Pad = 8;
-int IO::_Precision = 8;
-char IO::_DoubleFormat[] = "%16.8lf";
+IO::NumberFormat IO::_NumberFormat;
 bool IO::_PrintOfflineDocuments = true;
 
+namespace {
+    // Guards IO::_NumberFormat.
+    std::mutex numberFormatMutex;
+}
+
 
 //=============================================================================
 // FILE NAME UTILITIES
@@ -133,8 +135,8 @@ FixSlashesInFilePath(const std::string &path)
 void IO::
 SetScientific(bool aTrueFalse)
 {
-    _Scientific = aTrueFalse;
-    ConstructDoubleOutputFormat();
+    std::lock_guard<std::mutex> lock(numberFormatMutex);
+    _NumberFormat.scientific = aTrueFalse;
 }
 
 //_____________________________________________________________________________
@@ -147,7 +149,8 @@ SetScientific(bool aTrueFalse)
 bool IO::
 GetScientific()
 {
-    return(_Scientific);
+    std::lock_guard<std::mutex> lock(numberFormatMutex);
+    return(_NumberFormat.scientific);
 }
 
 //-----------------------------------------------------------------------------
@@ -160,8 +163,8 @@ GetScientific()
 void IO::
 SetGFormatForDoubleOutput(bool aTrueFalse)
 {
-    _GFormatForDoubleOutput = aTrueFalse;
-    ConstructDoubleOutputFormat();
+    std::lock_guard<std::mutex> lock(numberFormatMutex);
+    _NumberFormat.gFormat = aTrueFalse;
 }
 
 //_____________________________________________________________________________
@@ -170,7 +173,8 @@ SetGFormatForDoubleOutput(bool aTrueFalse)
 bool IO::
 GetGFormatForDoubleOutput()
 {
-    return(_GFormatForDoubleOutput);
+    std::lock_guard<std::mutex> lock(numberFormatMutex);
+    return(_NumberFormat.gFormat);
 }
 
 //-----------------------------------------------------------------------------
@@ -192,8 +196,8 @@ void IO::
 SetDigitsPad(int aPad)
 {
     if(aPad<0) aPad = -1;
-    _Pad = aPad;
-    ConstructDoubleOutputFormat();
+    std::lock_guard<std::mutex> lock(numberFormatMutex);
+    _NumberFormat.pad = aPad;
 }
 //_____________________________________________________________________________
 /**
@@ -210,7 +214,8 @@ SetDigitsPad(int aPad)
 int IO::
 GetDigitsPad()
 {
-    return(_Pad);
+    std::lock_guard<std::mutex> lock(numberFormatMutex);
+    return(_NumberFormat.pad);
 }
 
 //-----------------------------------------------------------------------------
@@ -227,8 +232,8 @@ void IO::
 SetPrecision(int aPrecision)
 {
     if(aPrecision<0) aPrecision = 0;
-    _Precision = aPrecision;
-    ConstructDoubleOutputFormat();
+    std::lock_guard<std::mutex> lock(numberFormatMutex);
+    _NumberFormat.precision = aPrecision;
 }
 //_____________________________________________________________________________
 /**
@@ -240,7 +245,8 @@ SetPrecision(int aPrecision)
 int IO::
 GetPrecision()
 {
-    return(_Precision);
+    std::lock_guard<std::mutex> lock(numberFormatMutex);
+    return(_NumberFormat.precision);
 }
 
 //-----------------------------------------------------------------------------
@@ -250,7 +256,7 @@ GetPrecision()
 /**
  * Get the current output format for numbers of type double.
  *
- * The format is maintained as a static variable in class IO, so any
+ * The format is built from the global output parameters in class IO, so any
  * changes made to the output parameters in class IO will be seen globally
  * by all classes using this method.
  *
@@ -261,45 +267,67 @@ GetPrecision()
  *
  * where the spaces have been removed and width = pad + precision.
  *
+ * The returned string is owned by the calling thread and is overwritten by the
+ * next call to this method on that thread.
+ *
  * @return Format string for output of doubles.
  * @see SetScientific(), SetDigitsPad, SetPrecision.
  */
 const char* IO::
 GetDoubleOutputFormat()
 {
-    return(_DoubleFormat);
+    thread_local char doubleFormat[IO_DBLFMTLEN];
+    snprintf(doubleFormat, IO_DBLFMTLEN, "%s",
+            GetDoubleOutputFormat(GetNumberFormat()).c_str());
+    return(doubleFormat);
 }
 
 //_____________________________________________________________________________
 /**
- * Construct a valid output format for numbers of type double.
- * This method is called each time a change is made to any of the output
- * format parameters.
+ * Get a snapshot of the current output parameters for numbers of type double.
  *
- * @see SetScientific(), SetDigitsPad, SetPrecision.
+ * @see GetDoubleOutputFormat(const NumberFormat&)
  */
-void IO::
-ConstructDoubleOutputFormat()
-{
-    if(_GFormatForDoubleOutput) {
-        snprintf(_DoubleFormat, IO_DBLFMTLEN, "%%g");
-    } else if(_Scientific) {
-        if(_Pad<0) {
-            snprintf(_DoubleFormat, IO_DBLFMTLEN,
-                     "%%.%dle", _Precision);
+IO::NumberFormat IO::
+GetNumberFormat()
+{
+    std::lock_guard<std::mutex> lock(numberFormatMutex);
+    return(_NumberFormat);
+}
+
+//_____________________________________________________________________________
+/**
+ * Construct a valid output format for numbers of type double from the
+ * given output parameters. No global state is consulted.
+ *
+ * @see GetDoubleOutputFormat()
+ */
+std::string IO::
+GetDoubleOutputFormat(const NumberFormat& aFormat)
+{
+    char doubleFormat[IO_DBLFMTLEN];
+    if(aFormat.gFormat) {
+        snprintf(doubleFormat, IO_DBLFMTLEN, "%%g");
+    } else if(aFormat.scientific) {
+        if(aFormat.pad<0) {
+            snprintf(doubleFormat, IO_DBLFMTLEN,
+                     "%%.%dle", aFormat.precision);
         } else {
-            snprintf(_DoubleFormat, IO_DBLFMTLEN,
-                     "%%%d.%dle", _Pad+_Precision, _Precision);
+            snprintf(doubleFormat, IO_DBLFMTLEN,
+                     "%%%d.%dle", aFormat.pad+aFormat.precision,
+                     aFormat.precision);
         }
     } else {
-        if(_Pad<0) {
-            snprintf(_DoubleFormat, IO_DBLFMTLEN,
-                     "%%.%dlf", _Precision);
+        if(aFormat.pad<0) {
+            snprintf(doubleFormat, IO_DBLFMTLEN,
+                     "%%.%dlf", aFormat.precision);
         } else {
-            snprintf(_DoubleFormat, IO_DBLFMTLEN,
-                     "%%%d.%dlf", _Pad+_Precision, _Precision);
+            snprintf(doubleFormat, IO_DBLFMTLEN,
+                     "%%%d.%dlf", aFormat.pad+aFormat.precision,
+                     aFormat.precision);
         }
     }
+    return(doubleFormat);
 }
 
 //=============================================================================
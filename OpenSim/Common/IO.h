@@ -31,6 +31,7 @@
 // INCLUDES
 #include "osimCommonDLL.h"
 #include <fstream>
+#include <string>
 #include <vector>
 
 // DEFINES
@@ -48,22 +49,28 @@ namespace OpenSim {
  * @author Frank C. Anderson
  */
 class OSIMCOMMON_API IO {
+public:
+    /** The parameters that determine how numbers of type double are output
+    (see SetScientific(), SetGFormatForDoubleOutput(), SetDigitsPad() and
+    SetPrecision()). A writer that formats many numbers, possibly on several
+    threads, should take a snapshot with GetNumberFormat() once and pass it
+    along, so that concurrent changes to the global format neither race with
+    it nor change the format partway through a file. */
+    struct NumberFormat {
+        bool scientific = false;
+        bool gFormat = false;
+        int pad = 8;
+        int precision = 8;
+    };
 
 //=============================================================================
 // DATA
 //=============================================================================
 private:
     // NUMBER OUTPUT
-    /** Specifies whether number output is in scientific or float format. */
-    static bool _Scientific;
-    /** Specifies whether number output is in %g format or not. */
-    static bool _GFormatForDoubleOutput;
-    /** Specifies number of digits of padding in number output. */ 
-    static int _Pad;
-    /** Specifies the precision of number output. */
-    static int _Precision;
-    /** The output format string. */
-    static char _DoubleFormat[IO_DBLFMTLEN];
+    /** The global number output format. Guarded by a mutex in IO.cpp, since
+    writers on any thread may read it. */
+    static NumberFormat _NumberFormat;
     /** Whether offline documents should also be printed when Object::print is called. */
     static bool _PrintOfflineDocuments;
 
@@ -86,8 +93,8 @@ public:
     static int GetPrecision();
     static const char*
         GetDoubleOutputFormat();
-private:
-    static void ConstructDoubleOutputFormat();
+    static NumberFormat GetNumberFormat();
+    static std::string GetDoubleOutputFormat(const NumberFormat& aFormat);
 
 public:
     // Object printing
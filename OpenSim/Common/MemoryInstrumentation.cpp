@@ -0,0 +1,395 @@
+/* -------------------------------------------------------------------------- *
+ *                   OpenSim:  MemoryInstrumentation.cpp                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MemoryInstrumentation.h"
+
+#include "Logger.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#if defined(_WIN32)
+    #include <malloc.h>
+    #include <psapi.h>
+#elif defined(__APPLE__)
+    #include <mach/mach.h>
+    #include <malloc/malloc.h>
+    #include <sys/resource.h>
+#elif defined(__linux__)
+    #include <fstream>
+    #include <malloc.h>
+#endif
+
+using namespace OpenSim;
+
+namespace {
+
+std::atomic<long long> numAllocations{0};
+std::atomic<long long> allocatedBytes{0};
+std::atomic<long long> liveHeapBytes{0};
+
+#if defined(OPENSIM_TRACK_ALLOCATIONS)
+    // Raise peak to value if value is larger.
+    void raiseToAtLeast(std::atomic<long long>& peak, long long value) {
+        long long current = peak.load(std::memory_order_relaxed);
+        while (value > current && !peak.compare_exchange_weak(
+                                          current, value,
+                                          std::memory_order_relaxed)) {
+        }
+    }
+
+    // The heap high-water marks of the active MemoryScopes. Each scope claims
+    // a slot for its lifetime, and every allocation raises the mark in every
+    // claimed slot, so overlapping scopes (nested, or on different threads)
+    // each keep their own peak. The slots are never freed, so an allocation
+    // on another thread never touches a scope that has already ended.
+    constexpr int maxActiveScopes = 64;
+    struct ScopeSlot {
+        std::atomic<bool> claimed{false};
+        std::atomic<long long> peakLiveHeapBytes{0};
+    };
+    ScopeSlot scopeSlots[maxActiveScopes];
+    // One past the highest slot that has been claimed.
+    std::atomic<int> numScopeSlotsUsed{0};
+
+    int claimScopeSlot(long long startLiveHeapBytes) {
+        for (int i = 0; i < maxActiveScopes; ++i) {
+            bool claimed = false;
+            if (scopeSlots[i].claimed.compare_exchange_strong(claimed, true)) {
+                scopeSlots[i].peakLiveHeapBytes.store(startLiveHeapBytes);
+                int used = numScopeSlotsUsed.load();
+                while (used < i + 1 &&
+                        !numScopeSlotsUsed.compare_exchange_weak(used, i + 1)) {
+                }
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // The size of a block as reported by the allocator. The same function is
+    // used when allocating and freeing, so the live byte count stays
+    // consistent (it includes the allocator's padding).
+    std::size_t getBlockSize(void* ptr) {
+    #if defined(_WIN32)
+        return _msize(ptr);
+    #elif defined(__APPLE__)
+        return malloc_size(ptr);
+    #elif defined(__linux__)
+        return malloc_usable_size(ptr);
+    #else
+        (void)ptr;
+        return 0;
+    #endif
+    }
+
+    void* trackedAllocate(std::size_t size) noexcept {
+        // Blocks come from malloc() (and are returned with free()), as with
+        // the default operator new, so blocks allocated by an operator new
+        // from another module can safely be freed here, and vice versa.
+        void* ptr = std::malloc(size == 0 ? 1 : size);
+        if (!ptr) return nullptr;
+        numAllocations.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        const long long blockSize = getBlockSize(ptr);
+        const long long live =
+                liveHeapBytes.fetch_add(blockSize, std::memory_order_relaxed) +
+                blockSize;
+        const int numSlots = numScopeSlotsUsed.load(std::memory_order_relaxed);
+        for (int i = 0; i < numSlots; ++i) {
+            if (scopeSlots[i].claimed.load(std::memory_order_relaxed)) {
+                raiseToAtLeast(scopeSlots[i].peakLiveHeapBytes, live);
+            }
+        }
+        return ptr;
+    }
+
+    void trackedFree(void* ptr) noexcept {
+        if (!ptr) return;
+        liveHeapBytes.fetch_sub(getBlockSize(ptr), std::memory_order_relaxed);
+        std::free(ptr);
+    }
+#endif
+
+#if defined(__linux__)
+    // Read a field such as "VmRSS:" (in kB) from /proc/self/status.
+    long long readProcStatusBytes(const std::string& field) {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.compare(0, field.size(), field) == 0) {
+                return std::atoll(line.c_str() + field.size()) * 1024;
+            }
+        }
+        return -1;
+    }
+#endif
+
+std::atomic<bool>& enabledFlag() {
+    static std::atomic<bool> enabled{[] {
+        const char* value = std::getenv("OPENSIM_MEMORY_INSTRUMENTATION");
+        return value && std::string(value) != "0" && std::string(value) != "";
+    }()};
+    return enabled;
+}
+
+std::mutex& scopeStatisticsMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<std::string, MemoryStatistics>& scopeStatistics() {
+    static std::map<std::string, MemoryStatistics> statistics;
+    return statistics;
+}
+
+} // anonymous namespace
+
+#if defined(OPENSIM_TRACK_ALLOCATIONS)
+void* operator new(std::size_t size) {
+    void* ptr = trackedAllocate(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+void* operator new[](std::size_t size) {
+    void* ptr = trackedAllocate(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return trackedAllocate(size);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return trackedAllocate(size);
+}
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    trackedFree(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    trackedFree(ptr);
+}
+#endif
+
+//=============================================================================
+// MemoryStatistics
+//=============================================================================
+std::string MemoryStatistics::toString() const {
+    std::string result;
+    if (numAllocations >= 0) {
+        result += fmt::format("{} allocations ({}), peak heap growth {}, ",
+                numAllocations, MemoryInstrumentation::formatBytes(
+                                        allocatedBytes),
+                MemoryInstrumentation::formatBytes(peakHeapGrowth));
+    }
+    if (peakResidentBytes >= 0) {
+        result += fmt::format("peak resident {} (+{})",
+                MemoryInstrumentation::formatBytes(peakResidentBytes),
+                MemoryInstrumentation::formatBytes(peakResidentGrowth));
+    } else {
+        result += "peak resident unavailable";
+    }
+    return result;
+}
+
+//=============================================================================
+// MemoryInstrumentation
+//=============================================================================
+void MemoryInstrumentation::setEnabled(bool enabled) {
+    enabledFlag() = enabled;
+}
+
+bool MemoryInstrumentation::isEnabled() { return enabledFlag(); }
+
+bool MemoryInstrumentation::isAllocationTrackingAvailable() {
+#if defined(OPENSIM_TRACK_ALLOCATIONS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+long long MemoryInstrumentation::getCurrentResidentBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(
+                GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long long>(counters.WorkingSetSize);
+    }
+    return -1;
+#elif defined(__APPLE__)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                reinterpret_cast<task_info_t>(&info), &count) ==
+            KERN_SUCCESS) {
+        return static_cast<long long>(info.resident_size);
+    }
+    return -1;
+#elif defined(__linux__)
+    return readProcStatusBytes("VmRSS:");
+#else
+    return -1;
+#endif
+}
+
+long long MemoryInstrumentation::getPeakResidentBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(
+                GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long long>(counters.PeakWorkingSetSize);
+    }
+    return -1;
+#elif defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        // Reported in bytes on macOS.
+        return static_cast<long long>(usage.ru_maxrss);
+    }
+    return -1;
+#elif defined(__linux__)
+    return readProcStatusBytes("VmHWM:");
+#else
+    return -1;
+#endif
+}
+
+long long MemoryInstrumentation::getNumAllocations() {
+    if (!isAllocationTrackingAvailable()) return -1;
+    return numAllocations.load(std::memory_order_relaxed);
+}
+
+long long MemoryInstrumentation::getAllocatedBytes() {
+    if (!isAllocationTrackingAvailable()) return -1;
+    return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+long long MemoryInstrumentation::getLiveHeapBytes() {
+    if (!isAllocationTrackingAvailable()) return -1;
+    return liveHeapBytes.load(std::memory_order_relaxed);
+}
+
+std::map<std::string, MemoryStatistics>
+MemoryInstrumentation::getScopeStatistics() {
+    std::lock_guard<std::mutex> lock(scopeStatisticsMutex());
+    return scopeStatistics();
+}
+
+void MemoryInstrumentation::resetScopeStatistics() {
+    std::lock_guard<std::mutex> lock(scopeStatisticsMutex());
+    scopeStatistics().clear();
+}
+
+std::string MemoryInstrumentation::formatBytes(long long bytes) {
+    if (bytes < 0) return "unavailable";
+    if (bytes < 1024) return fmt::format("{} B", bytes);
+    const char* units[] = {"KB", "MB", "GB", "TB"};
+    double value = static_cast<double>(bytes) / 1024.0;
+    int unit = 0;
+    while (value >= 1024.0 && unit < 3) {
+        value /= 1024.0;
+        ++unit;
+    }
+    return fmt::format("{:.1f} {}", value, units[unit]);
+}
+
+//=============================================================================
+// MemoryScope
+//=============================================================================
+MemoryScope::MemoryScope(std::string name) : m_name(std::move(name)) {
+    if (!MemoryInstrumentation::isEnabled()) return;
+    m_active = true;
+    m_startNumAllocations = numAllocations.load(std::memory_order_relaxed);
+    m_startAllocatedBytes = allocatedBytes.load(std::memory_order_relaxed);
+    m_startLiveHeapBytes = liveHeapBytes.load(std::memory_order_relaxed);
+    m_startPeakResidentBytes = MemoryInstrumentation::getPeakResidentBytes();
+#if defined(OPENSIM_TRACK_ALLOCATIONS)
+    // Start a heap high-water mark of this scope's own.
+    m_heapSlot = claimScopeSlot(m_startLiveHeapBytes);
+#endif
+}
+
+MemoryStatistics MemoryScope::getStatistics() const {
+    MemoryStatistics statistics;
+    if (!m_active) return statistics;
+    statistics.numScopes = 1;
+    if (MemoryInstrumentation::isAllocationTrackingAvailable()) {
+        statistics.numAllocations =
+                numAllocations.load(std::memory_order_relaxed) -
+                m_startNumAllocations;
+        statistics.allocatedBytes =
+                allocatedBytes.load(std::memory_order_relaxed) -
+                m_startAllocatedBytes;
+#if defined(OPENSIM_TRACK_ALLOCATIONS)
+        if (m_heapSlot >= 0) {
+            statistics.peakHeapGrowth = std::max(0LL,
+                    scopeSlots[m_heapSlot].peakLiveHeapBytes.load(
+                            std::memory_order_relaxed) -
+                            m_startLiveHeapBytes);
+        }
+#endif
+    }
+    statistics.peakResidentBytes = MemoryInstrumentation::getPeakResidentBytes();
+    if (statistics.peakResidentBytes >= 0 && m_startPeakResidentBytes >= 0) {
+        statistics.peakResidentGrowth =
+                statistics.peakResidentBytes - m_startPeakResidentBytes;
+    }
+    return statistics;
+}
+
+MemoryScope::~MemoryScope() {
+    if (!m_active) return;
+    try {
+        const MemoryStatistics statistics = getStatistics();
+
+        log_info("Memory usage ({}): {}.", m_name, statistics.toString());
+
+        std::lock_guard<std::mutex> lock(scopeStatisticsMutex());
+        MemoryStatistics& total = scopeStatistics()[m_name];
+        if (total.numScopes == 0) {
+            total = statistics;
+        } else {
+            total.numScopes += 1;
+            if (statistics.numAllocations >= 0) {
+                total.numAllocations += statistics.numAllocations;
+                total.allocatedBytes += statistics.allocatedBytes;
+            }
+            total.peakHeapGrowth =
+                    std::max(total.peakHeapGrowth, statistics.peakHeapGrowth);
+            total.peakResidentGrowth = std::max(
+                    total.peakResidentGrowth, statistics.peakResidentGrowth);
+            total.peakResidentBytes = std::max(
+                    total.peakResidentBytes, statistics.peakResidentBytes);
+        }
+    } catch (...) {
+        // Instrumentation must never interrupt the instrumented code.
+    }
+#if defined(OPENSIM_TRACK_ALLOCATIONS)
+    if (m_heapSlot >= 0) scopeSlots[m_heapSlot].claimed.store(false);
+#endif
+}
@@ -0,0 +1,158 @@
+#ifndef OPENSIM_MEMORYINSTRUMENTATION_H_
+#define OPENSIM_MEMORYINSTRUMENTATION_H_
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  MemoryInstrumentation.h                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCommonDLL.h"
+#include <map>
+#include <string>
+
+namespace OpenSim {
+
+/// Memory used while a MemoryScope was active. Quantities that are not
+/// available on the current platform or build are -1 (see
+/// MemoryInstrumentation::isAllocationTrackingAvailable()).
+/// @ingroup commonutil
+struct OSIMCOMMON_API MemoryStatistics {
+    /// The number of scopes (with the same name) that these statistics
+    /// combine.
+    int numScopes = 0;
+    /// The number of calls to operator new.
+    long long numAllocations = -1;
+    /// The total number of bytes requested from operator new.
+    long long allocatedBytes = -1;
+    /// The largest increase in the number of bytes allocated with operator
+    /// new and not yet freed, relative to the start of the scope.
+    long long peakHeapGrowth = -1;
+    /// The increase in the process's peak resident set size (the memory
+    /// high-water mark) during the scope, in bytes.
+    long long peakResidentGrowth = -1;
+    /// The process's peak resident set size at the end of the scope, in
+    /// bytes.
+    long long peakResidentBytes = -1;
+
+    /// A one-line summary, e.g., "12034 allocations (85.2 MB), peak heap
+    /// growth 20.1 MB, peak resident 310.4 MB (+15.0 MB)".
+    std::string toString() const;
+};
+
+/// Opt-in reporting of memory usage by tools and solvers.
+///
+/// Instrumentation is disabled by default. Enable it with setEnabled() or by
+/// setting the environment variable `OPENSIM_MEMORY_INSTRUMENTATION` to 1
+/// before the first call to isEnabled(). When it is enabled, each MemoryScope
+/// logs its statistics when it ends, and adds them to the statistics returned
+/// by getScopeStatistics(), so a benchmark can compare them against a
+/// baseline.
+///
+/// The resident set size is always available (on Linux, macOS, and Windows).
+/// Counting allocations requires building OpenSim with the CMake option
+/// `OPENSIM_TRACK_ALLOCATIONS`, which replaces the global operator new and
+/// operator delete with versions that update a few atomic counters. The
+/// replacement operators are exported from osimCommon; on Linux they see all
+/// allocations in the process, while on Windows and macOS they may only see
+/// allocations made from osimCommon itself.
+/// @ingroup commonutil
+class OSIMCOMMON_API MemoryInstrumentation {
+public:
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /// Whether this build counts allocations (OPENSIM_TRACK_ALLOCATIONS).
+    static bool isAllocationTrackingAvailable();
+
+    /// The current resident set size of the process, in bytes, or -1 if it
+    /// is not available on this platform.
+    static long long getCurrentResidentBytes();
+    /// The peak resident set size of the process since it started, in
+    /// bytes, or -1 if it is not available on this platform.
+    static long long getPeakResidentBytes();
+
+    /// The number of calls to operator new since the process started, or -1
+    /// if allocations are not tracked.
+    static long long getNumAllocations();
+    /// The total number of bytes requested from operator new since the
+    /// process started, or -1 if allocations are not tracked.
+    static long long getAllocatedBytes();
+    /// The number of bytes currently allocated with operator new, or -1 if
+    /// allocations are not tracked.
+    static long long getLiveHeapBytes();
+
+    /// Statistics for every MemoryScope that has ended while instrumentation
+    /// was enabled, combined by scope name: counts and bytes are summed, and
+    /// peaks are the largest of any scope.
+    static std::map<std::string, MemoryStatistics> getScopeStatistics();
+    /// Clear the statistics returned by getScopeStatistics().
+    static void resetScopeStatistics();
+
+    /// Format a number of bytes with a binary prefix, e.g., "12.5 MB".
+    static std::string formatBytes(long long bytes);
+};
+
+/// Measure the memory used by a region of code, such as a tool's run()
+/// method:
+/// @code
+/// bool InverseKinematicsTool::run() {
+///     MemoryScope memoryScope("InverseKinematicsTool");
+///     ...
+/// }
+/// @endcode
+/// If MemoryInstrumentation is disabled when the scope is constructed, the
+/// scope does nothing. Otherwise, it logs its statistics (at the info level)
+/// and records them with MemoryInstrumentation when it is destroyed.
+///
+/// Each scope keeps its own heap high-water mark, so scopes that overlap,
+/// whether nested or on different threads, do not disturb each other's peak
+/// heap growth. Up to 64 scopes can track their peak heap growth at once;
+/// beyond that, peakHeapGrowth is -1. Allocations on all threads are counted,
+/// so a scope includes the work of any threads it starts (e.g., with
+/// parallelFor()); scopes that run concurrently on different threads count
+/// each other's allocations.
+/// @ingroup commonutil
+class OSIMCOMMON_API MemoryScope {
+public:
+    explicit MemoryScope(std::string name);
+    ~MemoryScope();
+
+    MemoryScope(const MemoryScope&) = delete;
+    MemoryScope& operator=(const MemoryScope&) = delete;
+
+    const std::string& getName() const { return m_name; }
+    bool isActive() const { return m_active; }
+    /// The statistics from the start of the scope until now.
+    MemoryStatistics getStatistics() const;
+
+private:
+    std::string m_name;
+    bool m_active = false;
+    long long m_startNumAllocations = 0;
+    long long m_startAllocatedBytes = 0;
+    long long m_startLiveHeapBytes = 0;
+    long long m_startPeakResidentBytes = 0;
+    // The slot that holds this scope's heap high-water mark, or -1 if
+    // allocations are not tracked or all slots were taken.
+    int m_heapSlot = -1;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MEMORYINSTRUMENTATION_H_
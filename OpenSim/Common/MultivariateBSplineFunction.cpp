@@ -0,0 +1,207 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: MultivariateBSplineFunction.cpp                                   *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2024 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MultivariateBSplineFunction.h"
+#include "Exception.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace OpenSim;
+
+namespace {
+
+constexpr int MaxDimension = MultivariateBSplineFunction::getMaxDimension();
+
+class SimTKMultivariateBSpline : public SimTK::Function {
+public:
+    SimTKMultivariateBSpline(const SimTK::Vector& coefficients,
+            const SimTK::Vector& lowerBounds, const SimTK::Vector& upperBounds,
+            int numIntervals)
+            : m_coefficients(coefficients), m_lowerBounds(lowerBounds),
+              m_dimension(lowerBounds.size()), m_numIntervals(numIntervals) {
+        OPENSIM_THROW_IF(m_dimension < 1 || m_dimension > MaxDimension,
+                Exception, "Expected dimension between 1 and {} but got {}.",
+                MaxDimension, m_dimension);
+        OPENSIM_THROW_IF(upperBounds.size() != m_dimension, Exception,
+                "Expected {} upper bounds but got {}.", m_dimension,
+                upperBounds.size());
+        OPENSIM_THROW_IF(numIntervals < 1, Exception,
+                "Expected num_intervals >= 1 but got {}.", numIntervals);
+
+        const int numBasis = numIntervals + 3;
+        m_inverseWidths.resize(m_dimension);
+        m_strides.resize(m_dimension);
+        int stride = 1;
+        for (int i = m_dimension - 1; i >= 0; --i) {
+            OPENSIM_THROW_IF(!(upperBounds[i] > lowerBounds[i]), Exception,
+                    "Expected upper bound {} to be greater than lower bound "
+                    "{} for component {}.",
+                    upperBounds[i], lowerBounds[i], i);
+            m_inverseWidths[i] =
+                    numIntervals / (upperBounds[i] - lowerBounds[i]);
+            m_strides[i] = stride;
+            stride *= numBasis;
+        }
+        OPENSIM_THROW_IF(coefficients.size() != stride, Exception,
+                "Expected {} coefficients but got {}.", stride,
+                coefficients.size());
+    }
+
+    double calcValue(const SimTK::Vector& x) const override {
+        double weights[MaxDimension][4];
+        const int offset = calcBasisWeights(x, -1, weights);
+        return contract(0, offset, 1.0, weights);
+    }
+
+    double calcDerivative(const SimTK::Array_<int>& derivComponent,
+            const SimTK::Vector& x) const override {
+        OPENSIM_THROW_IF(derivComponent.size() != 1, Exception,
+                "Expected a first derivative but got a derivative of order "
+                "{}.", derivComponent.size());
+        double weights[MaxDimension][4];
+        const int offset = calcBasisWeights(x, derivComponent[0], weights);
+        return contract(0, offset, 1.0, weights);
+    }
+
+    void calcCoefficientWeights(const SimTK::Vector& x, int derivComponent,
+            std::vector<int>& indices, SimTK::Vector& weightsOut) const {
+        double weights[MaxDimension][4];
+        const int offset = calcBasisWeights(x, derivComponent, weights);
+        int numTerms = 1;
+        for (int i = 0; i < m_dimension; ++i) numTerms *= 4;
+        indices.resize(numTerms);
+        weightsOut.resize(numTerms);
+        // Enumerate the 4^dimension terms with the last component varying
+        // fastest (an odometer over the per-component basis offsets).
+        int digits[MaxDimension] = {0};
+        for (int term = 0; term < numTerms; ++term) {
+            int index = offset;
+            double weight = 1.0;
+            for (int i = 0; i < m_dimension; ++i) {
+                index += digits[i] * m_strides[i];
+                weight *= weights[i][digits[i]];
+            }
+            indices[term] = index;
+            weightsOut[term] = weight;
+            for (int i = m_dimension - 1; i >= 0; --i) {
+                if (++digits[i] < 4) break;
+                digits[i] = 0;
+            }
+        }
+    }
+
+    int getArgumentSize() const override { return m_dimension; }
+    int getMaxDerivativeOrder() const override { return 1; }
+    SimTKMultivariateBSpline* clone() const override {
+        return new SimTKMultivariateBSpline(*this);
+    }
+
+private:
+    // Fill in the values of the 4 nonzero basis functions for each component
+    // (or their derivatives, for derivComponent) and return the index of the
+    // coefficient multiplying the first nonzero basis function of every
+    // component.
+    int calcBasisWeights(const SimTK::Vector& x, int derivComponent,
+            double weights[][4]) const {
+        OPENSIM_THROW_IF(x.size() != m_dimension, Exception,
+                "Expected an input of size {} but got {}.", m_dimension,
+                x.size());
+        OPENSIM_THROW_IF(derivComponent >= m_dimension, Exception,
+                "Expected a derivative component less than {} but got {}.",
+                m_dimension, derivComponent);
+        int offset = 0;
+        for (int i = 0; i < m_dimension; ++i) {
+            const double u = (x[i] - m_lowerBounds[i]) * m_inverseWidths[i];
+            // Points outside the domain use the nearest interval, which
+            // extrapolates its cubic polynomial.
+            const int cell = std::min(std::max(static_cast<int>(std::floor(u)),
+                    0), m_numIntervals - 1);
+            const double t = u - cell;
+            const double s = 1.0 - t;
+            double* w = weights[i];
+            if (i == derivComponent) {
+                // Chain rule: du/dx is the inverse of the interval width.
+                const double dudx = m_inverseWidths[i];
+                w[0] = -0.5 * s * s * dudx;
+                w[1] = (1.5 * t * t - 2.0 * t) * dudx;
+                w[2] = (-1.5 * t * t + t + 0.5) * dudx;
+                w[3] = 0.5 * t * t * dudx;
+            } else {
+                const double t2 = t * t;
+                const double t3 = t2 * t;
+                w[0] = s * s * s / 6.0;
+                w[1] = (3.0 * t3 - 6.0 * t2 + 4.0) / 6.0;
+                w[2] = (-3.0 * t3 + 3.0 * t2 + 3.0 * t + 1.0) / 6.0;
+                w[3] = t3 / 6.0;
+            }
+            offset += cell * m_strides[i];
+        }
+        return offset;
+    }
+
+    // Sum the 4^dimension terms recursively. The innermost level is a
+    // 4-element dot product over contiguous coefficients (the last component
+    // has unit stride), which compilers vectorize.
+    double contract(int level, int offset, double scale,
+            const double weights[][4]) const {
+        const double* w = weights[level];
+        if (level == m_dimension - 1) {
+            const double* c = &m_coefficients[offset];
+            return scale * (w[0] * c[0] + w[1] * c[1] + w[2] * c[2] +
+                                   w[3] * c[3]);
+        }
+        const int stride = m_strides[level];
+        double result = 0;
+        for (int k = 0; k < 4; ++k) {
+            result += contract(level + 1, offset + k * stride, scale * w[k],
+                    weights);
+        }
+        return result;
+    }
+
+    SimTK::Vector m_coefficients;
+    SimTK::Vector m_lowerBounds;
+    SimTK::Vector m_inverseWidths;
+    SimTK::Array_<int> m_strides;
+    int m_dimension;
+    int m_numIntervals;
+};
+
+} // anonymous namespace
+
+int MultivariateBSplineFunction::getNumCoefficients() const {
+    int numCoefficients = 1;
+    for (int i = 0; i < getDimension(); ++i) {
+        numCoefficients *= get_num_intervals() + 3;
+    }
+    return numCoefficients;
+}
+
+SimTK::Function* MultivariateBSplineFunction::createSimTKFunction() const {
+    return new SimTKMultivariateBSpline(get_coefficients(), get_lower_bounds(),
+            get_upper_bounds(), get_num_intervals());
+}
+
+void MultivariateBSplineFunction::getCoefficientWeights(const SimTK::Vector& x,
+        int derivComponent, std::vector<int>& indices,
+        SimTK::Vector& weights) const {
+    if (!_function) {
+        _function = createSimTKFunction();
+    }
+    dynamic_cast<const SimTKMultivariateBSpline*>(_function)
+            ->calcCoefficientWeights(x, derivComponent, indices, weights);
+}
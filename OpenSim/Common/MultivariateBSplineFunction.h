@@ -0,0 +1,152 @@
+#ifndef OPENSIM_MULTIVARIATEBSPLINE_FUNCTION_H_
+#define OPENSIM_MULTIVARIATEBSPLINE_FUNCTION_H_
+/* -------------------------------------------------------------------------- *
+ * OpenSim: MultivariateBSplineFunction.h                                     *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2024 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCommonDLL.h"
+#include "Function.h"
+
+namespace OpenSim {
+
+/**
+ * A multivariate function defined as a tensor product of uniform cubic
+ * B-splines.
+ *
+ * The domain [lower_bounds[i], upper_bounds[i]] of each of the `dimension`
+ * independent components is divided into `num_intervals` equal intervals,
+ * giving `num_intervals + 3` basis functions per component and
+ * (num_intervals + 3)^dimension coefficients in total. The coefficients are
+ * stored with the last component varying fastest: the coefficient of basis
+ * functions (k_0, ..., k_{d-1}) has index
+ * k_{d-1} + m (k_{d-2} + m (k_{d-3} + ...)), where m = num_intervals + 3.
+ *
+ * Only 4 basis functions per component are nonzero at any point, so each
+ * evaluation sums exactly 4^dimension terms, regardless of the number of
+ * intervals. Compared to a MultivariatePolynomialFunction of high order, the
+ * function is cheaper to evaluate and, since each coefficient only affects
+ * the function locally, a fit to sampled data does not oscillate near the
+ * edges of the sampled domain.
+ *
+ * Outside of the bounds, the cubic polynomial of the nearest interval is
+ * extrapolated.
+ *
+ * This implementation allows computation of first-order derivatives only.
+ *
+ * @note The dimension is limited to getMaxDimension() (8), since the cost of
+ *       evaluation grows as 4^dimension.
+ */
+class OSIMCOMMON_API MultivariateBSplineFunction : public Function {
+    OpenSim_DECLARE_CONCRETE_OBJECT(MultivariateBSplineFunction, Function);
+
+public:
+    OpenSim_DECLARE_PROPERTY(coefficients, SimTK::Vector,
+            "Coefficients of the tensor-product B-spline basis functions, with "
+            "the basis functions of the last independent component varying "
+            "fastest.");
+    OpenSim_DECLARE_PROPERTY(lower_bounds, SimTK::Vector,
+            "The lower end of the domain of each independent component.");
+    OpenSim_DECLARE_PROPERTY(upper_bounds, SimTK::Vector,
+            "The upper end of the domain of each independent component.");
+    OpenSim_DECLARE_PROPERTY(num_intervals, int,
+            "The number of equal intervals into which the domain of each "
+            "independent component is divided (default: 4).");
+
+    MultivariateBSplineFunction() { constructProperties(); }
+
+    MultivariateBSplineFunction(SimTK::Vector coefficients,
+            SimTK::Vector lowerBounds, SimTK::Vector upperBounds,
+            int numIntervals) {
+        constructProperties();
+        set_coefficients(std::move(coefficients));
+        set_lower_bounds(std::move(lowerBounds));
+        set_upper_bounds(std::move(upperBounds));
+        set_num_intervals(numIntervals);
+    }
+
+    /**
+     * The vector of coefficients for the B-spline basis functions.
+     */
+    void setCoefficients(SimTK::Vector coefficients) {
+        set_coefficients(std::move(coefficients));
+        resetFunction();
+    }
+    /// @copydoc setCoefficients()
+    const SimTK::Vector& getCoefficients() const { return get_coefficients(); }
+
+    /**
+     * The domain of the independent components. The dimension of the
+     * function is the size of these vectors.
+     */
+    void setBounds(SimTK::Vector lowerBounds, SimTK::Vector upperBounds) {
+        set_lower_bounds(std::move(lowerBounds));
+        set_upper_bounds(std::move(upperBounds));
+        resetFunction();
+    }
+    /// @copydoc setBounds()
+    const SimTK::Vector& getLowerBounds() const { return get_lower_bounds(); }
+    /// @copydoc setBounds()
+    const SimTK::Vector& getUpperBounds() const { return get_upper_bounds(); }
+
+    /**
+     * The number of intervals per independent component.
+     */
+    void setNumIntervals(int numIntervals) {
+        set_num_intervals(numIntervals);
+        resetFunction();
+    }
+    /// @copydoc setNumIntervals()
+    int getNumIntervals() const { return get_num_intervals(); }
+
+    /// The number of independent components.
+    int getDimension() const { return get_lower_bounds().size(); }
+
+    /// The number of coefficients required for the current dimension and
+    /// number of intervals.
+    int getNumCoefficients() const;
+
+    /// The largest dimension supported.
+    static constexpr int getMaxDimension() { return 8; }
+
+    /**
+     * Return a pointer to a SimTK::Function object that implements this
+     * function.
+     */
+    SimTK::Function* createSimTKFunction() const override;
+
+    /**
+     * Get the coefficients that contribute to the value of the function at
+     * `x` (or to its partial derivative with respect to component
+     * `derivComponent`, if `derivComponent` is not -1), along with their
+     * weights, so that the value is
+     * `sum_k weights[k] * coefficients[indices[k]]`. Both outputs have
+     * 4^dimension elements. This is useful for fitting the coefficients to
+     * data with least squares.
+     */
+    void getCoefficientWeights(const SimTK::Vector& x, int derivComponent,
+            std::vector<int>& indices, SimTK::Vector& weights) const;
+
+private:
+    void constructProperties() {
+        constructProperty_coefficients(SimTK::Vector(0));
+        constructProperty_lower_bounds(SimTK::Vector(0));
+        constructProperty_upper_bounds(SimTK::Vector(0));
+        constructProperty_num_intervals(4);
+    }
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MULTIVARIATEBSPLINE_FUNCTION_H_
@@ -188,6 +188,7 @@ Object& Object::operator=(const Object& source)
         _authors        = source._authors;
         _references     = source._references;
         _propertyTable  = source._propertyTable;
+        handleNameChange();
         _document.reset();
         _inlined = true; // meaning: not associated to an XML document
     }
@@ -301,6 +302,7 @@ void Object::
 setName(const string &aName)
 {
     _name = aName;
+    handleNameChange();
 }
 //_____________________________________________________________________________
 /**
@@ -578,6 +578,12 @@ protected:
     name is empty, should have the property name. **/
     void makeObjectNamesConsistentWithProperties();
 
+    /** This is called after the name of this %Object is changed with
+    setName() or by assignment, so that derived classes can update values
+    derived from the name (e.g., the absolute paths that Component caches).
+    The default implementation does nothing. **/
+    virtual void handleNameChange() {}
+
     /** Use this method only if you're deserializing from a file and the object
     is at the top level; that is, primarily in constructors that take a file
     name as input. **/
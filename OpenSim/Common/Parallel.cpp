@@ -0,0 +1,156 @@
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  Parallel.cpp                            *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "Parallel.h"
+
+#include "Exception.h"
+#include <atomic>
+#include <exception>
+
+using namespace OpenSim;
+
+ThreadPool::ThreadPool(int numThreads) {
+    OPENSIM_THROW_IF(numThreads < 0, Exception,
+            "Expected the number of threads to be non-negative, but received "
+            "{}.", numThreads);
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_workers.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        m_workers.emplace_back([this] { runWorker(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_taskAvailable.notify_all();
+    for (auto& worker : m_workers) worker.join();
+}
+
+ThreadPool& ThreadPool::getDefault() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        OPENSIM_THROW_IF(m_stopping, Exception,
+                "Cannot submit a task to a ThreadPool that is shutting down.");
+        m_tasks.push(std::move(task));
+    }
+    m_taskAvailable.notify_one();
+}
+
+void ThreadPool::runWorker() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_taskAvailable.wait(lock,
+                    [this] { return m_stopping || !m_tasks.empty(); });
+            // Drain the queue before stopping so that every future that was
+            // handed out becomes ready.
+            if (m_tasks.empty()) return;
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+        task();
+    }
+}
+
+namespace {
+    // State shared by the calling thread and the pool tasks that help it in
+    // parallelForChunks(). Helper tasks may start after the call has returned
+    // (if the pool was busy), so this is held by a shared_ptr; such late
+    // helpers find no chunks left and never touch func.
+    struct ChunkSchedule {
+        ChunkSchedule(int numChunks, const std::function<void(int)>& func)
+                : numChunks(numChunks), func(func) {}
+        const int numChunks;
+        const std::function<void(int)>& func;
+        std::atomic<int> nextChunk{0};
+        std::atomic<bool> failed{false};
+        std::mutex mutex;
+        std::condition_variable allFinished;
+        int numFinished = 0;
+        int failedChunk = -1;
+        std::exception_ptr exception;
+
+        // Claim and run chunks until none are left.
+        void work() {
+            while (true) {
+                const int chunk = nextChunk.fetch_add(1);
+                if (chunk >= numChunks) return;
+                if (!failed.load()) {
+                    try {
+                        func(chunk);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (failedChunk < 0 || chunk < failedChunk) {
+                            failedChunk = chunk;
+                            exception = std::current_exception();
+                        }
+                        failed.store(true);
+                    }
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                if (++numFinished == numChunks) allFinished.notify_all();
+            }
+        }
+    };
+}
+
+void OpenSim::parallelForChunks(int numChunks,
+        const std::function<void(int chunk)>& func, int numThreads) {
+    OPENSIM_THROW_IF(numThreads < 0, Exception,
+            "Expected the number of threads to be non-negative, but received "
+            "{}.", numThreads);
+    if (numChunks <= 0) return;
+
+    ThreadPool& pool = ThreadPool::getDefault();
+    if (numThreads == 0) numThreads = pool.getNumThreads();
+    const int numHelpers = std::min({numThreads - 1, numChunks - 1,
+                                     pool.getNumThreads()});
+    if (numHelpers <= 0) {
+        for (int chunk = 0; chunk < numChunks; ++chunk) func(chunk);
+        return;
+    }
+
+    auto schedule = std::make_shared<ChunkSchedule>(numChunks, func);
+    for (int i = 0; i < numHelpers; ++i) {
+        pool.submit([schedule] { schedule->work(); });
+    }
+    // The calling thread works too, so the loop completes even if every pool
+    // thread is busy (e.g., when parallelForChunks() is nested).
+    schedule->work();
+    {
+        std::unique_lock<std::mutex> lock(schedule->mutex);
+        schedule->allFinished.wait(lock,
+                [&] { return schedule->numFinished == numChunks; });
+    }
+    if (schedule->exception) std::rethrow_exception(schedule->exception);
+}
@@ -0,0 +1,194 @@
+#ifndef OPENSIM_PARALLEL_H_
+#define OPENSIM_PARALLEL_H_
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  Parallel.h                              *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCommonDLL.h"
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace OpenSim {
+
+/// A fixed-size pool of worker threads that runs submitted tasks in the
+/// order they were submitted. Use submit() wherever you would otherwise call
+/// `std::async(std::launch::async, ...)`; the returned std::future behaves the
+/// same way (including rethrowing exceptions from get()), but the threads are
+/// created once and reused.
+///
+/// Most code should not need to create its own pool: parallelFor() and
+/// parallelReduce() use getDefault().
+/// @ingroup commonutil
+class OSIMCOMMON_API ThreadPool {
+public:
+    /// Create a pool with the given number of worker threads. If numThreads
+    /// is 0, the pool uses std::thread::hardware_concurrency() threads.
+    explicit ThreadPool(int numThreads = 0);
+    /// Finish all tasks that have already been submitted, then join the
+    /// worker threads.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// The number of worker threads in this pool.
+    int getNumThreads() const { return static_cast<int>(m_workers.size()); }
+
+    /// Queue a task to run on one of the worker threads.
+    template <typename Func>
+    auto submit(Func&& func) -> std::future<decltype(func())> {
+        using Result = decltype(func());
+        auto task = std::make_shared<std::packaged_task<Result()>>(
+                std::forward<Func>(func));
+        std::future<Result> future = task->get_future();
+        enqueue([task]() { (*task)(); });
+        return future;
+    }
+
+    /// A process-wide pool with one worker per hardware thread, created on
+    /// first use.
+    static ThreadPool& getDefault();
+
+private:
+    void enqueue(std::function<void()> task);
+    void runWorker();
+
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_taskAvailable;
+    bool m_stopping = false;
+};
+
+/// Call `func(chunk)` for each chunk in [0, numChunks), using up to
+/// numThreads threads (the calling thread is one of them). If numThreads is
+/// 0, all threads in ThreadPool::getDefault() may be used. Chunks are handed
+/// out in increasing order, but may finish in any order. The calling thread
+/// also processes chunks, so it is safe to call this function from within a
+/// task that is already running on the pool.
+///
+/// If one or more calls to func throw, the remaining chunks are skipped and
+/// the exception from the lowest-numbered failing chunk is rethrown once all
+/// running chunks have finished.
+/// @ingroup commonutil
+OSIMCOMMON_API void parallelForChunks(int numChunks,
+        const std::function<void(int chunk)>& func, int numThreads = 0);
+
+/// Call `func(index)` for each index in [begin, end), in parallel. Indices are
+/// grouped into consecutive chunks of grainSize indices; use a larger
+/// grainSize when func is cheap. See parallelForChunks() for the meaning of
+/// numThreads and for exception handling.
+/// @ingroup commonutil
+template <typename Func>
+void parallelFor(int begin, int end, Func&& func, int numThreads = 0,
+        int grainSize = 1) {
+    if (end <= begin) return;
+    const int grain = grainSize < 1 ? 1 : grainSize;
+    const int numChunks = (end - begin + grain - 1) / grain;
+    parallelForChunks(numChunks,
+            [begin, end, grain, &func](int chunk) {
+                const int chunkBegin = begin + chunk * grain;
+                const int chunkEnd = std::min(chunkBegin + grain, end);
+                for (int i = chunkBegin; i < chunkEnd; ++i) func(i);
+            },
+            numThreads);
+}
+
+/// The order in which parallelReduce() combines the results of its chunks.
+/// @ingroup commonutil
+enum class ReductionOrder {
+    /// Combine chunk results left to right: ((c0 + c1) + c2) + ...
+    Sequential,
+    /// Combine chunk results as a balanced binary tree:
+    /// (c0 + c1) + (c2 + c3) + ... This accumulates less round-off error
+    /// than Sequential for long floating-point sums.
+    Pairwise
+};
+
+/// Reduce `map(index)` for each index in [begin, end) with the associative
+/// operation `combine(T, T) -> T`, starting from identity.
+///
+/// The result is bit-identical for any numThreads (including 1): the indices
+/// are split into chunks of grainSize indices regardless of the number of
+/// threads, each chunk is folded left to right, and the chunk results are
+/// combined on the calling thread in a fixed order (see ReductionOrder).
+/// Changing grainSize or order can change floating-point results, so keep
+/// them fixed when you need reproducible output.
+/// @ingroup commonutil
+template <typename T, typename Map, typename Combine>
+T parallelReduce(int begin, int end, const T& identity, Map&& map,
+        Combine&& combine, int numThreads = 0, int grainSize = 256,
+        ReductionOrder order = ReductionOrder::Pairwise) {
+    if (end <= begin) return identity;
+    const int grain = grainSize < 1 ? 1 : grainSize;
+    const int numChunks = (end - begin + grain - 1) / grain;
+    std::vector<T> partials(numChunks, identity);
+    parallelForChunks(numChunks,
+            [&](int chunk) {
+                const int chunkBegin = begin + chunk * grain;
+                const int chunkEnd = std::min(chunkBegin + grain, end);
+                T value = identity;
+                for (int i = chunkBegin; i < chunkEnd; ++i) {
+                    value = combine(value, map(i));
+                }
+                partials[chunk] = std::move(value);
+            },
+            numThreads);
+
+    if (order == ReductionOrder::Sequential) {
+        T result = identity;
+        for (auto& partial : partials) {
+            result = combine(result, partial);
+        }
+        return result;
+    }
+    // Pairwise: repeatedly combine neighbors until one value remains.
+    for (int width = 1; width < numChunks; width *= 2) {
+        for (int i = 0; i + width < numChunks; i += 2 * width) {
+            partials[i] = combine(partials[i], partials[i + width]);
+        }
+    }
+    return partials[0];
+}
+
+/// Sum `map(index)` for each index in [begin, end). This is parallelReduce()
+/// with addition and pairwise ordering, so the result does not depend on
+/// numThreads.
+/// @ingroup commonutil
+template <typename T, typename Map>
+T parallelSum(int begin, int end, const T& zero, Map&& map,
+        int numThreads = 0, int grainSize = 256) {
+    return parallelReduce(begin, end, zero, std::forward<Map>(map),
+            [](const T& a, const T& b) { return a + b; }, numThreads,
+            grainSize, ReductionOrder::Pairwise);
+}
+
+} // namespace OpenSim
+
+#endif // OPENSIM_PARALLEL_H_
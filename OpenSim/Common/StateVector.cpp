@@ -30,6 +30,8 @@
 #include "IO.h"
 #include "StateVector.h"
 
+#include <algorithm>
+
 using namespace OpenSim;
 using namespace std;
 
@@ -527,7 +529,8 @@ divide(StateVector *aStateVector)
 //=============================================================================
 //_____________________________________________________________________________
 /**
- * Print the contents of this StateVector to file.
+ * Print the contents of this StateVector to file, using the current global
+ * output format for numbers (see IO::GetDoubleOutputFormat()).
  *
  * The number of characters written to file is returned.  If an error
  * occurs, a negative value is returned.
@@ -541,35 +544,51 @@ print(FILE *fp) const
         return(-1);
     }
 
-    // TIME
-    char format[IO_STRLEN];
-    snprintf(format, IO_STRLEN, "%s", IO::GetDoubleOutputFormat());
-    int n=0,nTotal=0;
-    n = fprintf(fp,format,_t);
+    // FORMAT
+    string line;
+    int n = appendTo(line, IO::GetDoubleOutputFormat(IO::GetNumberFormat()));
     if(n<0) {
-        log_error("StateVector.print(FILE*): error writing to file.");
+        log_error("StateVector.print(FILE*): error formatting states.");
         return(n);
     }
-    nTotal += n;
+
+    // WRITE
+    if(fwrite(line.data(),1,line.size(),fp)!=line.size()) {
+        log_error("StateVector.print(FILE*): error writing to file.");
+        return(-1);
+    }
+
+    return(n);
+}
+//_____________________________________________________________________________
+/**
+ * Append the contents of this StateVector, followed by a carriage return, to
+ * a string.
+ *
+ * The number of characters appended is returned.  If an error occurs, a
+ * negative value is returned.
+ */
+int StateVector::
+appendTo(string& buffer, const string& aDoubleFormat) const
+{
+    char number[IO_STRLEN];
+    const size_t start = buffer.size();
+
+    // TIME
+    int n = snprintf(number, IO_STRLEN, aDoubleFormat.c_str(), _t);
+    if(n<0) return(n);
+    buffer.append(number, std::min(n, IO_STRLEN-1));
 
     // STATES
-    snprintf(format, IO_STRLEN, "\t%s", IO::GetDoubleOutputFormat());
     for(int i=0;i<_data.getSize();i++) {
-        n = fprintf(fp,format,_data[i]);
-        if(n<0) {
-            log_error("StateVector.print(FILE*): error writing to file.");
-            return(n);
-        }
-        nTotal += n;
+        n = snprintf(number, IO_STRLEN, aDoubleFormat.c_str(), _data[i]);
+        if(n<0) return(n);
+        buffer += '\t';
+        buffer.append(number, std::min(n, IO_STRLEN-1));
     }
 
     // CARRIAGE RETURN
-    n = fprintf(fp,"\n");
-    if(n<0) {
-        log_error("StateVector.print(FILE*): error writing to file.");
-        return(n);
-    }
-    nTotal += n;
+    buffer += '\n';
 
-    return(nTotal);
+    return((int)(buffer.size()-start));
 }
@@ -131,6 +131,12 @@ public:
     //--------------------------------------------------------------------------
 #ifndef SWIG
     int print(FILE *fp) const;
+    /** Append this StateVector to `buffer` as one line of text, with the time
+    and each state formatted with the printf format `aDoubleFormat` (see
+    IO::GetDoubleOutputFormat()). No global state is consulted, so several
+    StateVectors can be formatted concurrently. Returns the number of
+    characters appended, or a negative number if formatting failed. */
+    int appendTo(std::string& buffer, const std::string& aDoubleFormat) const;
 #endif
 
 //=============================================================================
@@ -35,6 +35,7 @@
 #include "GCVSplineSet.h"
 #include "IO.h"
 #include "Logger.h"
+#include "Parallel.h"
 #include "STOFileAdapter.h"
 #include "Signal.h"
 #include "SimTKcommon.h"
@@ -42,6 +43,7 @@
 #include "StateVector.h"
 #include "TableUtilities.h"
 #include "TimeSeriesTable.h"
+#include <algorithm>
 #include <iostream>
 
 using namespace OpenSim;
@@ -414,7 +416,6 @@ setNull()
     _writeSIMMHeader = false;
     setHeaderToken(DEFAULT_HEADER_TOKEN);
     _stepInterval = 1;
-    _lastI = 0;
     _fp = 0;
     _inDegrees = false;
 }
@@ -1014,7 +1015,7 @@ getDataAtTime(double aT,int aN,double **rData) const
 {
 
     // FIND THE CORRECT INTERVAL FOR aT
-    int i = findIndex(_lastI,aT);
+    int i = findIndex(aT);
     if((i<0)||(_storage.getSize()<=0)) {
         *rData = NULL;
         return(0);
@@ -2438,15 +2439,34 @@ lowpassFIR(int aOrder,double aCutoffFrequency)
 //=============================================================================
 // UTILITY
 //=============================================================================
+namespace {
+// Return the first index in [lo, hi) whose time is greater than aT, or hi if
+// there is none. Times are assumed to be nondecreasing.
+int findFirstIndexAfter(const Array<StateVector>& storage, int lo, int hi,
+        double aT)
+{
+    while(lo<hi) {
+        const int mid = lo + (hi-lo)/2;
+        if(aT<storage[mid].getTime()) hi = mid;
+        else lo = mid+1;
+    }
+    return lo;
+}
+}
 //_____________________________________________________________________________
 /**
  * Find the index of the storage element that occurred immediately before
- * or at time aT ( aT <= getTime(index) ).
+ * or at time aT ( getTime(index) <= aT ).
+ *
+ * aI is a caller-owned cursor for sequential access: when querying
+ * increasing times, pass the index returned by the previous call. The search
+ * then gallops forward from aI, so its cost grows with the logarithm of the
+ * distance from aI rather than with the size of the storage. If aI is not a
+ * valid index or corresponds to a state which occurred later than aT, this
+ * is equivalent to findIndex(aT).
  *
- * This method can be much more efficient than findIndex(aT) if a good guess
- * is made for aI.
- * If aI corresponds to a state which occurred later than aT, an exhaustive
- * search is performed by calling findIndex(aT).
+ * This method does not modify the storage, so a const Storage may be
+ * searched from several threads at once.
  *
  * @param aI Index at which to start searching.
  * @param aT Time.
@@ -2457,27 +2477,30 @@ int Storage::
 findIndex(int aI,double aT) const
 {
     // MAKE SURE aI IS VALID
-    if(_storage.getSize()<=0) return(-1);
-    if((aI>=_storage.getSize())||(aI<0)) aI=0;
-    if(getStateVector(aI)->getTime()>aT) aI=0;
+    const int size = _storage.getSize();
+    if(size<=0) return(-1);
+    if((aI>=size)||(aI<0)||(_storage[aI].getTime()>aT)) return findIndex(aT);
 
-    // SEARCH
-    //cout << "Storage.findIndex: starting at " << aI << endl;
-    int i;
-    for(i=aI;i<_storage.getSize();i++) {
-        if(aT<getStateVector(i)->getTime()) break;
+    // GALLOP FORWARD TO BRACKET aT, THEN BISECT
+    // All states before lo occurred at or before aT.
+    int lo = aI+1;
+    int hi = lo;
+    int step = 1;
+    while((hi<size)&&!(aT<_storage[hi].getTime())) {
+        lo = hi+1;
+        hi = lo+step;
+        step *= 2;
     }
-    _lastI = i-1;
-    if(_lastI<0) _lastI=0;
-    return(_lastI);
+    if(hi>size) hi = size;
+    return findFirstIndexAfter(_storage,lo,hi,aT)-1;
 }
 //_____________________________________________________________________________
 /**
  * Find the index of the storage element that occurred immediately before
  * or at a specified time ( getTime(index) <= aT ).
  *
- * This method is not very efficient because it always starts its search
- * with the first stored state.
+ * The times are bisected, so this method takes O(log n) time and does not
+ * modify the storage. It assumes that the times are nondecreasing.
  *
  * @param aT Time.
  * @return Index preceding or at time aT.  If aT is less than the earliest
@@ -2486,14 +2509,10 @@ findIndex(int aI,double aT) const
 int Storage::
 findIndex(double aT) const
 {
-    if(_storage.getSize()<=0) return(-1);
-    int i;
-    for(i=0;i<_storage.getSize();i++) {
-        if(aT<getStateVector(i)->getTime()) break;
-    }
-    _lastI = i-1;
-    if(_lastI<0) _lastI=0;
-    return(_lastI);
+    const int size = _storage.getSize();
+    if(size<=0) return(-1);
+    const int i = findFirstIndexAfter(_storage,0,size,aT)-1;
+    return (i<0) ? 0 : i;
 }
 //_____________________________________________________________________________
 /**
@@ -2655,6 +2674,46 @@ setOutputFileName(const std::string& aFileName)
     // WRITE THE COLUMN LABELS
     writeColumnLabels(_fp);
 }
+namespace {
+// Write rows [0, numRows) of a storage file. Formatting numbers dominates the
+// cost of writing, so blocks of rows are formatted into strings on the thread
+// pool by formatBlock(begin, end, buffer), which returns false on error, and
+// the strings are then written to fp in order. Only one batch of blocks (one
+// per thread) is held in memory at a time. Returns the number of characters
+// written, or -1 on error.
+int writeRowsInBlocks(FILE* fp, int numRows,
+        const std::function<bool(int, int, std::string&)>& formatBlock) {
+    constexpr int blockSize = 1024;
+    const int numBlocks = (numRows + blockSize - 1) / blockSize;
+    const int batchSize =
+            std::max(1, ThreadPool::getDefault().getNumThreads());
+    std::vector<std::string> blocks;
+    std::vector<char> blockOK;
+    int nTotal = 0;
+    for (int firstBlock = 0; firstBlock < numBlocks;
+            firstBlock += batchSize) {
+        const int numInBatch = std::min(batchSize, numBlocks - firstBlock);
+        blocks.assign(numInBatch, std::string());
+        blockOK.assign(numInBatch, 0);
+        parallelForChunks(numInBatch, [&](int iblock) {
+            const int begin = (firstBlock + iblock) * blockSize;
+            const int end = std::min(begin + blockSize, numRows);
+            blockOK[iblock] = formatBlock(begin, end, blocks[iblock]);
+        });
+        for (int iblock = 0; iblock < numInBatch; ++iblock) {
+            const std::string& block = blocks[iblock];
+            if (!blockOK[iblock] ||
+                    fwrite(block.data(), 1, block.size(), fp) !=
+                            block.size()) {
+                return -1;
+            }
+            nTotal += (int)block.size();
+        }
+    }
+    return nTotal;
+}
+} // anonymous namespace
+
 //_____________________________________________________________________________
 /**
  * Print the contents of this storage instance to a file.
@@ -2718,14 +2777,24 @@ print(const string &aFileName,const string &aMode, const string& aComment) const
 //std::cout << aFileName << endl;
 
     // VECTORS
-    for(int i=0;i<_storage.getSize();i++) {
-        n = getStateVector(i)->print(fp);
-        if(n<0) {
-            log_error("Storage.print: error printing to {}.", aFileName);
-            return(false);
-        }
-        nTotal += n;
+    // The number format is read once, so the whole file uses one format
+    // even if IO::SetPrecision() etc. are called concurrently.
+    const string doubleFormat =
+            IO::GetDoubleOutputFormat(IO::GetNumberFormat());
+    n = writeRowsInBlocks(fp, _storage.getSize(),
+            [&](int begin, int end, string& buffer) {
+                for(int i=begin;i<end;i++) {
+                    if(getStateVector(i)->appendTo(buffer, doubleFormat)<0)
+                        return false;
+                }
+                return true;
+            });
+    if(n<0) {
+        log_error("Storage.print: error printing to {}.", aFileName);
+        fclose(fp);
+        return(false);
     }
+    nTotal += n;
 
     // CLOSE
     fclose(fp);
@@ -2800,27 +2869,35 @@ print(const string &aFileName,double aDT,const string &aMode) const
     }
 
     // LOOP THROUGH THE DATA
-    int i,ny=0;
-    double t,*y=NULL;
-    StateVector vec;
-    for(t=ti,i=0;i<nr;i++,t=ti+aDT*(double)i) {
-
-        // INTERPOLATE THE STATES
-        ny = getDataAtTime(t,ny,&y);
-        vec.setStates(t, SimTK::Vector_<double>(ny, y));
-
-        // PRINT
-        n = vec.print(fp);
-        if(n<0) {
-            log_error("Storage.print: error printing to {}.", aFileName);
-            return(n);
-        }
-        nTotal += n;
+    // The number format is read once, so the whole file uses one format
+    // even if IO::SetPrecision() etc. are called concurrently.
+    const string doubleFormat =
+            IO::GetDoubleOutputFormat(IO::GetNumberFormat());
+    n = writeRowsInBlocks(fp, nr,
+            [&](int begin, int end, string& buffer) {
+                int ny=0;
+                double *y=NULL;
+                StateVector vec;
+                bool ok = true;
+                for(int i=begin;ok&&(i<end);i++) {
+                    // INTERPOLATE THE STATES
+                    const double t = ti+aDT*(double)i;
+                    ny = getDataAtTime(t,ny,&y);
+                    vec.setStates(t, SimTK::Vector_<double>(ny, y));
+                    ok = vec.appendTo(buffer, doubleFormat)>=0;
+                }
+                if(y!=NULL) delete[] y;
+                return ok;
+            });
+    if(n<0) {
+        log_error("Storage.print: error printing to {}.", aFileName);
+        fclose(fp);
+        return(n);
     }
+    nTotal += n;
 
     // CLEANUP
     fclose(fp);
-    if(y!=NULL) { delete[] y;  y=NULL; }
 
     return(nTotal);
 }
@@ -30,6 +30,8 @@
 #include "Signal.h"
 #include "Storage.h"
 
+#include <unordered_map>
+
 using namespace OpenSim;
 
 void TableUtilities::checkNonUniqueLabels(std::vector<std::string> labels) {
@@ -63,60 +65,109 @@ int TableUtilities::findStateLabelIndex(
             labels.data(), labels.data() + labels.size(), desired);
 }
 
+std::vector<int> TableUtilities::findStateLabelIndices(
+        const Array<std::string>& labels, const Array<std::string>& desired) {
+    return findStateLabelIndicesInternal(
+            labels.get(), labels.get() + labels.getSize(), desired);
+}
+
+std::vector<int> TableUtilities::findStateLabelIndices(
+        const std::vector<std::string>& labels,
+        const Array<std::string>& desired) {
+    return findStateLabelIndicesInternal(
+            labels.data(), labels.data() + labels.size(), desired);
+}
+
+namespace {
+    // Search for the desired state label, trying each of the forms the
+    // column label could take (see TableUtilities::findStateLabelIndex()) in
+    // order of preference. 'find' returns the index of the column with the
+    // given label, or -1 if there is no such column.
+    template <typename FindFunction>
+    int resolveStateLabel(const std::string& desired, FindFunction find) {
+
+        int found = find(desired);
+        if (found != -1) return found;
+
+        // 4.0 and its beta versions differ slightly in the absolute path but
+        // the <joint>/<coordinate>/value (or speed) will be common to both.
+        // Likewise, for muscle states <muscle>/activation (or fiber_length)
+        // must be common to the state variable (path) name and column label.
+        std::string shortPath = desired;
+        std::string::size_type front = shortPath.find('/');
+        while (found == -1 && front < std::string::npos) {
+            shortPath = shortPath.substr(front + 1, desired.length());
+            found = find(shortPath);
+            front = shortPath.find('/');
+        }
+        if (found != -1) return found;
+
+        // Assume column labels follow pre-v4.0 state variable labeling.
+        // Redo search with what the pre-v4.0 label might have been.
+
+        // First, try just the last element of the path.
+        std::string::size_type back = desired.rfind('/');
+        std::string prefix = desired.substr(0, back);
+        std::string shortName =
+                desired.substr(back + 1, desired.length() - back);
+        found = find(shortName);
+        if (found != -1) return found;
+
+        // If that didn't work, specifically check for coordinate state names
+        // (<coord_name>/value and <coord_name>/speed) and muscle state names
+        // (<muscle_name>/activation <muscle_name>/fiber_length).
+        if (shortName == "value") {
+            // pre-v4.0 did not have "/value" so remove it if here
+            back = prefix.rfind('/');
+            shortName = prefix.substr(back + 1, prefix.length());
+            found = find(shortName);
+        } else if (shortName == "speed") {
+            // replace "/speed" (the v4.0 labeling for speeds) with "_u"
+            back = prefix.rfind('/');
+            shortName = prefix.substr(back + 1, prefix.length() - back) + "_u";
+            found = find(shortName);
+        } else if (back < desired.length()) {
+            // try replacing the '/' with '.' in the last segment
+            shortName = desired;
+            shortName.replace(back, 1, ".");
+            back = shortName.rfind('/');
+            shortName = shortName.substr(back + 1, shortName.length() - back);
+            found = find(shortName);
+        }
+
+        // If all of the above checks failed, this is -1.
+        return found;
+    }
+}
+
 int TableUtilities::findStateLabelIndexInternal(const std::string* begin,
         const std::string* end, const std::string& desired) {
+    return resolveStateLabel(desired, [begin, end](const std::string& label) {
+        auto found = std::find(begin, end, label);
+        return found != end ? (int)std::distance(begin, found) : -1;
+    });
+}
 
-    auto found = std::find(begin, end, desired);
-    if (found != end) return (int)std::distance(begin, found);
-
-    // 4.0 and its beta versions differ slightly in the absolute path but
-    // the <joint>/<coordinate>/value (or speed) will be common to both.
-    // Likewise, for muscle states <muscle>/activation (or fiber_length)
-    // must be common to the state variable (path) name and column label.
-    std::string shortPath = desired;
-    std::string::size_type front = shortPath.find('/');
-    while (found == end && front < std::string::npos) {
-        shortPath = shortPath.substr(front + 1, desired.length());
-        found = std::find(begin, end, shortPath);
-        front = shortPath.find('/');
+std::vector<int> TableUtilities::findStateLabelIndicesInternal(
+        const std::string* begin, const std::string* end,
+        const Array<std::string>& desired) {
+    // Map each label to the index of its first occurrence, which is the
+    // index std::find would return.
+    std::unordered_map<std::string, int> labelIndices;
+    labelIndices.reserve(std::distance(begin, end));
+    for (auto it = begin; it != end; ++it) {
+        labelIndices.emplace(*it, (int)std::distance(begin, it));
     }
-    if (found != end) return (int)std::distance(begin, found);
-
-    // Assume column labels follow pre-v4.0 state variable labeling.
-    // Redo search with what the pre-v4.0 label might have been.
-
-    // First, try just the last element of the path.
-    std::string::size_type back = desired.rfind('/');
-    std::string prefix = desired.substr(0, back);
-    std::string shortName = desired.substr(back + 1, desired.length() - back);
-    found = std::find(begin, end, shortName);
-    if (found != end) return (int)std::distance(begin, found);
-
-    // If that didn't work, specifically check for coordinate state names
-    // (<coord_name>/value and <coord_name>/speed) and muscle state names
-    // (<muscle_name>/activation <muscle_name>/fiber_length).
-    if (shortName == "value") {
-        // pre-v4.0 did not have "/value" so remove it if here
-        back = prefix.rfind('/');
-        shortName = prefix.substr(back + 1, prefix.length());
-        found = std::find(begin, end, shortName);
-    } else if (shortName == "speed") {
-        // replace "/speed" (the v4.0 labeling for speeds) with "_u"
-        back = prefix.rfind('/');
-        shortName = prefix.substr(back + 1, prefix.length() - back) + "_u";
-        found = std::find(begin, end, shortName);
-    } else if (back < desired.length()) {
-        // try replacing the '/' with '.' in the last segment
-        shortName = desired;
-        shortName.replace(back, 1, ".");
-        back = shortName.rfind('/');
-        shortName = shortName.substr(back + 1, shortName.length() - back);
-        found = std::find(begin, end, shortName);
+    const auto find = [&labelIndices](const std::string& label) {
+        auto found = labelIndices.find(label);
+        return found != labelIndices.end() ? found->second : -1;
+    };
+
+    std::vector<int> indices(desired.getSize());
+    for (int i = 0; i < desired.getSize(); ++i) {
+        indices[i] = resolveStateLabel(desired[i], find);
     }
-    if (found != end) return (int)std::distance(begin, found);
-
-    // If all of the above checks failed, return -1.
-    return -1;
+    return indices;
 }
 
 void TableUtilities::filterLowpass(
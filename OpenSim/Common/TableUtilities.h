@@ -60,6 +60,22 @@ public:
     static int findStateLabelIndex(
             const std::vector<std::string>& labels, const std::string& desired);
 
+    /// Get the indices in the provided array of labels that correspond to
+    /// each of the desired labels (typically, the names returned by
+    /// Model::getStateVariableNames()). Each element of the result is the
+    /// value findStateLabelIndex() would return for the corresponding desired
+    /// label, but the labels are hashed once up front, so this is much faster
+    /// than calling findStateLabelIndex() for each desired label when there
+    /// are many labels.
+    static std::vector<int> findStateLabelIndices(
+            const Array<std::string>& labels,
+            const Array<std::string>& desired);
+
+    /// @copydoc findStateLabelIndices()
+    static std::vector<int> findStateLabelIndices(
+            const std::vector<std::string>& labels,
+            const Array<std::string>& desired);
+
     /// Lowpass filter the data in a TimeSeriesTable at a provided cutoff
     /// frequency. If padData is true, then the data is first padded with pad()
     /// using numRowsToPrependAndAppend = table.getNumRows() / 2.
@@ -107,6 +123,9 @@ public:
 private:
     static int findStateLabelIndexInternal(const std::string* begin,
             const std::string* end, const std::string& desired);
+    static std::vector<int> findStateLabelIndicesInternal(
+            const std::string* begin, const std::string* end,
+            const Array<std::string>& desired);
 };
 
 } // namespace OpenSim
@@ -1327,6 +1327,65 @@ TEST_CASE("Component Interface Component Path Names")
     top.connect();
 }
 
+TEST_CASE("Component Interface Cached Absolute Paths")
+{
+    TheWorld top;
+    top.setName("Top");
+    TheWorld* A = new TheWorld();
+    TheWorld* B = new TheWorld();
+    TheWorld* C = new TheWorld();
+    A->setName("A");
+    B->setName("B");
+    C->setName("C");
+    top.add(A);
+    A->add(B);
+    B->add(C);
+    top.finalizeFromProperties();
+    top.connect();
+
+    CHECK(top.getAbsolutePathString() == "/");
+    CHECK(A->getAbsolutePathString() == "/A");
+    CHECK(C->getAbsolutePathString() == "/A/B/C");
+
+    SECTION("Renaming an ancestor updates the paths of its descendants")
+    {
+        B->setName("B2");
+        CHECK(C->getAbsolutePathString() == "/A/B2/C");
+        top.finalizeFromProperties();
+        top.connect();
+        CHECK(C->getAbsolutePathString() == "/A/B2/C");
+    }
+
+    SECTION("A copy does not reuse the cached path of the original")
+    {
+        TheWorld copy(*B);
+        CHECK(copy.getAbsolutePathString() == "/");
+        copy.finalizeFromProperties();
+        copy.connect();
+        CHECK(copy.getComponent("C").getAbsolutePathString() == "/C");
+        copy.updComponent("C").setName("C2");
+        CHECK(copy.getComponent("C2").getAbsolutePathString() == "/C2");
+        CHECK(C->getAbsolutePathString() == "/A/B/C");
+    }
+
+    SECTION("The cached path is returned by reference and kept up to date")
+    {
+        const std::string& path = C->getAbsolutePathStringRef();
+        CHECK(&path == &C->getAbsolutePathStringRef());
+        // Renaming a Component in another tree does not affect this tree.
+        TheWorld other;
+        TheWorld* D = new TheWorld();
+        D->setName("D");
+        other.add(D);
+        D->setName("D2");
+        CHECK(D->getAbsolutePathStringRef() == "/D2");
+        CHECK(path == "/A/B/C");
+        A->setName("A2");
+        CHECK(&path == &C->getAbsolutePathStringRef());
+        CHECK(path == "/A2/B/C");
+    }
+}
+
 TEST_CASE("Component Interface Component::findComponent")
 {
     class A : public Component {
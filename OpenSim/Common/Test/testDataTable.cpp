@@ -835,6 +835,28 @@ TEST_CASE("TableUtilities::findStateLabelIndex") {
                   "/jointset/hip/hip_flexion/value") == -1);
 }
 
+TEST_CASE("TableUtilities::findStateLabelIndices") {
+    const std::vector<std::string> labels{"time", "hip_flexion",
+            "/jointset/knee/knee_angle/value", "hip_flexion_u",
+            "knee/knee_angle/speed", "vasti.activation", "hip_flexion"};
+    Array<std::string> desired;
+    desired.append("/jointset/hip/hip_flexion/value");
+    desired.append("/jointset/hip/hip_flexion/speed");
+    desired.append("/jointset/knee/knee_angle/value");
+    desired.append("/jointset/knee/knee_angle/speed");
+    desired.append("/forceset/vasti/activation");
+    desired.append("/forceset/vasti/fiber_length");
+
+    const std::vector<int> indices =
+            TableUtilities::findStateLabelIndices(labels, desired);
+    REQUIRE(indices.size() == 6);
+    CHECK(indices == std::vector<int>{1, 3, 2, 4, 5, -1});
+    for (int i = 0; i < desired.getSize(); ++i) {
+        CHECK(indices[i] ==
+                TableUtilities::findStateLabelIndex(labels, desired[i]));
+    }
+}
+
 TEST_CASE("TableUtilities::filterLowpass") {
     const int numRows = 100;
 
@@ -986,4 +1008,41 @@ TEST_CASE("TimeSeriesTable trim methods") {
         table.trimToIndices(0, 0);
         CHECK(table.getNumRows() == 1);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("DataTable column label lookups follow label changes") {
+    TimeSeriesTable table;
+    table.setColumnLabels({"a", "b", "c"});
+    table.appendRow(0.0, {1, 2, 3});
+    CHECK(table.getColumnIndex("c") == 2);
+    CHECK_FALSE(table.hasColumn("d"));
+
+    table.appendColumn("d", std::vector<double>{4});
+    CHECK(table.hasColumn("d"));
+    CHECK(table.getColumnIndex("d") == 3);
+
+    table.removeColumn("a");
+    CHECK_FALSE(table.hasColumn("a"));
+    CHECK(table.getColumnIndex("b") == 0);
+    CHECK(table.getDependentColumn("d")[0] == 4);
+    CHECK_THROWS_AS(table.removeColumn("a"), KeyNotFound);
+
+    // Copies keep their own labels.
+    TimeSeriesTable copy(table);
+    copy.setColumnLabel(0, "e");
+    CHECK(copy.hasColumn("e"));
+    CHECK_FALSE(copy.hasColumn("b"));
+    CHECK(table.hasColumn("b"));
+    CHECK_FALSE(table.hasColumn("e"));
+    table = copy;
+    CHECK(table.getColumnIndex("e") == 0);
+
+    // A rejected label leaves the previous labels in place.
+    CHECK_THROWS(table.setColumnLabels({"e", " c", "d"}));
+    CHECK(table.getColumnIndex("e") == 0);
+    CHECK_FALSE(table.hasColumn(" c"));
+
+    // The first column wins for duplicate labels.
+    table.setColumnLabels({"x", "x", "y"});
+    CHECK(table.getColumnIndex("x") == 0);
+}
@@ -24,6 +24,7 @@
 #include "ComponentsForTesting.h"
 
 #include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/MultivariateBSplineFunction.h>
 #include <OpenSim/Common/MultivariatePolynomialFunction.h>
 #include <OpenSim/Common/Reporter.h>
 #include <OpenSim/Common/SignalGenerator.h>
@@ -239,6 +240,116 @@ TEST_CASE("MultivariatePolynomialFunction") {
     }
 }
 
+TEST_CASE("MultivariateBSplineFunction") {
+    SECTION("Input errors") {
+        {
+            MultivariateBSplineFunction f(createVector({1}), SimTK::Vector(),
+                    SimTK::Vector(), 1);
+            CHECK_THROWS_WITH(f.calcValue(SimTK::Vector()),
+                    ContainsSubstring("Expected dimension"));
+        }
+        {
+            MultivariateBSplineFunction f(SimTK::Vector(24),
+                    createVector({0, 0}), createVector({1, 1}), 2);
+            CHECK_THROWS_WITH(f.calcValue(createVector({0.5, 0.5})),
+                    ContainsSubstring("Expected 25 coefficients but got 24"));
+        }
+        {
+            MultivariateBSplineFunction f(SimTK::Vector(5),
+                    createVector({1}), createVector({0}), 2);
+            CHECK_THROWS_WITH(f.calcValue(createVector({0.5})),
+                    ContainsSubstring("to be greater than lower bound"));
+        }
+    }
+    SECTION("Partition of unity") {
+        MultivariateBSplineFunction f(SimTK::Vector(7 * 7 * 7, 1.0),
+                createVector({-1, 0, 2}), createVector({1, 3, 4}), 4);
+        CHECK(f.getNumCoefficients() == 343);
+        // Includes a point outside of the bounds.
+        for (const auto& x : {createVector({0.1, 0.2, 3.3}),
+                              createVector({-1, 3, 2}),
+                              createVector({1.5, -0.5, 3.9})}) {
+            CHECK(f.calcValue(x) == Approx(1.0));
+            for (int i = 0; i < 3; ++i) {
+                CHECK(f.calcDerivative({i}, x) == Approx(0.0).margin(1e-12));
+            }
+        }
+    }
+    SECTION("Reproduces linear functions") {
+        // The coefficient of basis function k is its value at the center of
+        // the basis function, lower + (k - 1) * width.
+        const int numIntervals = 3;
+        const int numBasis = numIntervals + 3;
+        const double lower0 = -1.0, width0 = 2.0 / numIntervals;
+        const double lower1 = 0.5, width1 = 1.5 / numIntervals;
+        SimTK::Vector c(numBasis * numBasis);
+        for (int k0 = 0; k0 < numBasis; ++k0) {
+            for (int k1 = 0; k1 < numBasis; ++k1) {
+                c[k0 * numBasis + k1] = 2.0 * (lower0 + (k0 - 1) * width0) -
+                                        3.0 * (lower1 + (k1 - 1) * width1);
+            }
+        }
+        MultivariateBSplineFunction f(c, createVector({-1.0, 0.5}),
+                createVector({1.0, 2.0}), numIntervals);
+        SimTK::Vector x = createVector({0.37, 1.21});
+        CHECK(f.calcValue(x) == Approx(2.0 * 0.37 - 3.0 * 1.21));
+        CHECK(f.calcDerivative({0}, x) == Approx(2.0));
+        CHECK(f.calcDerivative({1}, x) == Approx(-3.0));
+    }
+    SECTION("Derivatives match finite differences") {
+        SimTK::Vector c = SimTK::Test::randVector(5 * 5 * 5);
+        MultivariateBSplineFunction f(c, createVector({0, 0, 0}),
+                createVector({1, 2, 3}), 2);
+        SimTK::Vector x = createVector({0.3, 1.7, 0.4});
+        const double h = 1e-6;
+        for (int i = 0; i < 3; ++i) {
+            SimTK::Vector xp = x;
+            SimTK::Vector xm = x;
+            xp[i] += h;
+            xm[i] -= h;
+            CHECK(f.calcDerivative({i}, x) ==
+                    Approx((f.calcValue(xp) - f.calcValue(xm)) / (2 * h))
+                            .epsilon(1e-6).margin(1e-8));
+        }
+        std::vector<int> indices;
+        SimTK::Vector weights;
+        f.getCoefficientWeights(x, -1, indices, weights);
+        REQUIRE(weights.size() == 64);
+        double value = 0;
+        for (int k = 0; k < weights.size(); ++k) {
+            value += weights[k] * c[indices[k]];
+        }
+        CHECK(value == Approx(f.calcValue(x)));
+        f.getCoefficientWeights(x, 1, indices, weights);
+        value = 0;
+        for (int k = 0; k < weights.size(); ++k) {
+            value += weights[k] * c[indices[k]];
+        }
+        CHECK(value == Approx(f.calcDerivative({1}, x)));
+    }
+    SECTION("Setters update a function that was already evaluated") {
+        MultivariateBSplineFunction f(SimTK::Vector(5, 1.0),
+                createVector({0}), createVector({1}), 2);
+        const SimTK::Vector x = createVector({0.3});
+        std::vector<int> indices;
+        SimTK::Vector weights;
+        f.getCoefficientWeights(x, -1, indices, weights);
+        CHECK(f.calcValue(x) == Approx(1.0));
+
+        f.setNumIntervals(4);
+        f.setCoefficients(SimTK::Vector(7, 2.0));
+        CHECK(f.calcValue(x) == Approx(2.0));
+        // With 4 intervals on [0, 1], x = 0.3 lies in the second interval,
+        // so the first contributing coefficient is the second one.
+        f.getCoefficientWeights(x, -1, indices, weights);
+        CHECK(indices[0] == 1);
+
+        f.setBounds(createVector({0.25}), createVector({1.25}));
+        f.getCoefficientWeights(x, -1, indices, weights);
+        CHECK(indices[0] == 0);
+    }
+}
+
 TEST_CASE("solveBisection()") {
 
     auto calcResidual = [](const SimTK::Real& x) { return x - 3.78; };
@@ -0,0 +1,118 @@
+/* -------------------------------------------------------------------------- *
+ *                 OpenSim:  testMemoryInstrumentation.cpp                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Common/MemoryInstrumentation.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+using namespace OpenSim;
+
+TEST_CASE("MemoryInstrumentation") {
+    const bool wasEnabled = MemoryInstrumentation::isEnabled();
+
+    SECTION("Disabled scopes do nothing") {
+        MemoryInstrumentation::setEnabled(false);
+        MemoryInstrumentation::resetScopeStatistics();
+        {
+            MemoryScope scope("disabled");
+            CHECK_FALSE(scope.isActive());
+            CHECK(scope.getStatistics().numScopes == 0);
+        }
+        CHECK(MemoryInstrumentation::getScopeStatistics().empty());
+    }
+
+    SECTION("Scopes record statistics") {
+        MemoryInstrumentation::setEnabled(true);
+        MemoryInstrumentation::resetScopeStatistics();
+        const int numBytes = 8 * 1024 * 1024;
+        for (int i = 0; i < 2; ++i) {
+            MemoryScope outer("outer");
+            REQUIRE(outer.isActive());
+            std::vector<char> buffer(numBytes, 1);
+            {
+                MemoryScope inner("inner");
+                std::vector<char> small(1024, 1);
+            }
+            const MemoryStatistics statistics = outer.getStatistics();
+            if (MemoryInstrumentation::isAllocationTrackingAvailable()) {
+                CHECK(statistics.numAllocations >= 2);
+                CHECK(statistics.allocatedBytes >= numBytes + 1024);
+                // The inner scope must not hide the outer scope's peak.
+                CHECK(statistics.peakHeapGrowth >= numBytes);
+            } else {
+                CHECK(statistics.numAllocations == -1);
+                CHECK(statistics.peakHeapGrowth == -1);
+            }
+        }
+        const auto all = MemoryInstrumentation::getScopeStatistics();
+        REQUIRE(all.count("outer") == 1);
+        REQUIRE(all.count("inner") == 1);
+        CHECK(all.at("outer").numScopes == 2);
+        CHECK(all.at("inner").numScopes == 2);
+        if (MemoryInstrumentation::isAllocationTrackingAvailable()) {
+            CHECK(all.at("outer").allocatedBytes >= 2 * numBytes);
+        }
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+        CHECK(MemoryInstrumentation::getCurrentResidentBytes() > 0);
+        CHECK(MemoryInstrumentation::getPeakResidentBytes() >=
+                MemoryInstrumentation::getCurrentResidentBytes());
+        CHECK(all.at("outer").peakResidentBytes > 0);
+#endif
+        MemoryInstrumentation::resetScopeStatistics();
+        CHECK(MemoryInstrumentation::getScopeStatistics().empty());
+    }
+
+    SECTION("Overlapping scopes keep their own peaks") {
+        MemoryInstrumentation::setEnabled(true);
+        const int numBytes = 8 * 1024 * 1024;
+        auto first = std::unique_ptr<MemoryScope>(new MemoryScope("first"));
+        { std::vector<char> buffer(numBytes, 1); }
+        // A scope that starts on another thread after the first scope's peak
+        // and ends after the first scope.
+        std::unique_ptr<MemoryScope> second;
+        std::thread([&]() { second.reset(new MemoryScope("second")); }).join();
+        REQUIRE(second->isActive());
+        if (MemoryInstrumentation::isAllocationTrackingAvailable()) {
+            CHECK(first->getStatistics().peakHeapGrowth >= numBytes);
+            CHECK(second->getStatistics().peakHeapGrowth < numBytes);
+        }
+        first.reset();
+        if (MemoryInstrumentation::isAllocationTrackingAvailable()) {
+            CHECK(second->getStatistics().peakHeapGrowth < numBytes);
+        }
+        second.reset();
+        MemoryInstrumentation::resetScopeStatistics();
+    }
+
+    SECTION("formatBytes()") {
+        CHECK(MemoryInstrumentation::formatBytes(-1) == "unavailable");
+        CHECK(MemoryInstrumentation::formatBytes(512) == "512 B");
+        CHECK(MemoryInstrumentation::formatBytes(1536) == "1.5 KB");
+        CHECK(MemoryInstrumentation::formatBytes(3 * 1024 * 1024) == "3.0 MB");
+    }
+
+    MemoryInstrumentation::setEnabled(wasEnabled);
+}
@@ -0,0 +1,110 @@
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  testParallel.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Common/Parallel.h>
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <catch2/catch_all.hpp>
+
+using namespace OpenSim;
+
+namespace {
+    // Terms of very different magnitudes, so that the floating-point sum
+    // depends on the order of the additions.
+    double term(int i) { return std::sin(0.37 * i) * 1e8 + 1.0 / (i + 1); }
+
+    bool bitIdentical(double a, double b) {
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+}
+
+TEST_CASE("parallelFor visits every index exactly once") {
+    const int numThreads = GENERATE(1, 2, 3, 8, 0);
+    const int grainSize = GENERATE(1, 7, 1000);
+    std::vector<int> visits(1000, 0);
+    parallelFor(0, 1000, [&](int i) { ++visits[i]; }, numThreads, grainSize);
+    for (int count : visits) CHECK(count == 1);
+
+    // Empty ranges are allowed.
+    parallelFor(5, 5, [&](int) { FAIL("Should not be called."); });
+}
+
+TEST_CASE("parallelReduce is independent of the number of threads") {
+    const int numTerms = 100003;
+    for (auto order : {ReductionOrder::Sequential, ReductionOrder::Pairwise}) {
+        const double expected = parallelReduce(0, numTerms, 0.0, term,
+                [](double a, double b) { return a + b; }, 1, 64, order);
+        for (int numThreads : {2, 3, 4, 7, 16, 0}) {
+            const double found = parallelReduce(0, numTerms, 0.0, term,
+                    [](double a, double b) { return a + b; }, numThreads, 64,
+                    order);
+            CHECK(bitIdentical(expected, found));
+        }
+    }
+
+    // parallelSum() uses pairwise ordering.
+    CHECK(bitIdentical(parallelSum(0, numTerms, 0.0, term, 1, 64),
+                       parallelSum(0, numTerms, 0.0, term, 5, 64)));
+
+    // Non-commutative reductions keep index order.
+    const std::string digits = parallelReduce(0, 20, std::string(),
+            [](int i) { return std::to_string(i % 10); },
+            [](const std::string& a, const std::string& b) { return a + b; },
+            4, 3);
+    CHECK(digits == "01234567890123456789");
+}
+
+TEST_CASE("parallelFor can be nested") {
+    std::vector<double> sums(16);
+    parallelFor(0, 16, [&](int i) {
+        sums[i] = parallelSum(0, 1000, 0.0, term, 0, 10);
+    });
+    for (double sum : sums) CHECK(bitIdentical(sums[0], sum));
+}
+
+TEST_CASE("parallelFor rethrows exceptions from the loop body") {
+    CHECK_THROWS_WITH(parallelFor(0, 100,
+            [](int i) {
+                if (i == 37) throw std::runtime_error("index 37");
+            }, 4),
+            "index 37");
+    CHECK_THROWS(parallelFor(0, 10, [](int) {}, -1));
+}
+
+TEST_CASE("ThreadPool") {
+    ThreadPool pool(3);
+    CHECK(pool.getNumThreads() == 3);
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 10; ++i) {
+        futures.push_back(pool.submit([i] { return i * i; }));
+    }
+    for (int i = 0; i < 10; ++i) CHECK(futures[i].get() == i * i);
+
+    auto failing = pool.submit([]() -> int {
+        throw std::runtime_error("failed task");
+    });
+    CHECK_THROWS_WITH(failing.get(), "failed task");
+}
@@ -349,6 +349,29 @@ TEST_CASE("Trimming whitespace in metadata values") {
     CHECK(table.getTableMetaDataAsString("inDegrees") == "yes");
 }
 
-
-
-
+TEST_CASE("Writing tables that span multiple formatting blocks") {
+    // Rows are formatted in blocks on worker threads; the rows must still
+    // appear in the file in order.
+    const std::string filename = "testing_multiple_write_blocks.sto";
+    FileRemover fileRemover(filename);
+    TimeSeriesTable table;
+    table.setColumnLabels({"a", "b", "c"});
+    const int numRows = 5000;
+    for (int i = 0; i < numRows; ++i) {
+        const double time = 0.001 * i;
+        table.appendRow(time, SimTK::RowVector(3, std::sin(time) / 3.0));
+    }
+    STOFileAdapter::write(table, filename);
+
+    TimeSeriesTable tableRead(filename);
+    REQUIRE(tableRead.getNumRows() == table.getNumRows());
+    REQUIRE(tableRead.getNumColumns() == table.getNumColumns());
+    for (int i = 0; i < numRows; ++i) {
+        CHECK(tableRead.getIndependentColumn()[i] ==
+                Catch::Approx(table.getIndependentColumn()[i]));
+        for (int j = 0; j < 3; ++j) {
+            CHECK(tableRead.getMatrix()(i, j) ==
+                    Catch::Approx(table.getMatrix()(i, j)));
+        }
+    }
+}
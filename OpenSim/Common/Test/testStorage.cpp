@@ -22,10 +22,16 @@
 
 #include <OpenSim/Common/Storage.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+#include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/STOFileAdapter.h>
 
 #include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <thread>
+#include <vector>
 
 using namespace OpenSim;
 using namespace std;
@@ -194,3 +200,122 @@ TEST_CASE("Verify the loading of marker data (14 markers) from .trc into a Stora
 {
     loadStorageWithNColsFromFile("dataWithNaNsOfDifferentCases.trc", 43);
 }
+
+TEST_CASE("Storage time lookup is logarithmic and thread-safe")
+{
+    // Nonuniform times t_i = i^2 / 100 with a single column y = 2 t.
+    Storage storage;
+    const int numRows = 1000;
+    for (int i = 0; i < numRows; ++i) {
+        const double t = i * i / 100.0;
+        const double y = 2 * t;
+        storage.append(t, 1, &y);
+    }
+
+    // Match the linear-search definition of findIndex().
+    auto expectedIndex = [&](double t) {
+        int i = 0;
+        while (i < numRows && !(t < storage.getStateVector(i)->getTime())) ++i;
+        return std::max(i - 1, 0);
+    };
+    for (double t : {-1.0, 0.0, 0.005, 0.01, 12.3456, 4000.0, 9980.01, 1e6}) {
+        CHECK(storage.findIndex(t) == expectedIndex(t));
+        CHECK(storage.findIndex(0, t) == expectedIndex(t));
+        CHECK(storage.findIndex(500, t) == expectedIndex(t));
+        CHECK(storage.findIndex(-3, t) == expectedIndex(t));
+    }
+
+    SECTION("A caller-owned cursor gives the same indices as a full search")
+    {
+        int cursor = 0;
+        for (double t = 0; t < 10000.0; t += 3.7) {
+            cursor = storage.findIndex(cursor, t);
+            REQUIRE(cursor == expectedIndex(t));
+        }
+    }
+
+    SECTION("A const Storage can be queried from several threads")
+    {
+        const Storage& constStorage = storage;
+        const int numThreads = 4;
+        std::vector<int> numErrors(numThreads, 0);
+        std::vector<std::thread> threads;
+        for (int ithread = 0; ithread < numThreads; ++ithread) {
+            threads.emplace_back([&, ithread]() {
+                // Each thread queries the times in a different order.
+                for (int k = 0; k < 2000; ++k) {
+                    const double t = ((k * (2 * ithread + 1) * 7919) % 99800)
+                                     / 10.0;
+                    double y = 0;
+                    constStorage.getDataAtTime(t, 1, &y);
+                    if (std::abs(y - 2 * t) > 1e-9) ++numErrors[ithread];
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        for (int ithread = 0; ithread < numThreads; ++ithread) {
+            CHECK(numErrors[ithread] == 0);
+        }
+    }
+}
+
+TEST_CASE("Storage printing spans multiple formatting blocks")
+{
+    // Rows are formatted in blocks on worker threads; the rows must still
+    // appear in the file in order, in the format set through IO.
+    Storage storage;
+    Array<std::string> labels;
+    labels.append("time");
+    labels.append("a");
+    labels.append("b");
+    storage.setColumnLabels(labels);
+    const int numRows = 5000;
+    for (int i = 0; i < numRows; ++i) {
+        const double t = 0.001 * i;
+        const double y[2] = {std::sin(t), 1000.0 * std::cos(t)};
+        storage.append(t, 2, y);
+    }
+    const int precision = IO::GetPrecision();
+    IO::SetPrecision(10);
+
+    SECTION("All rows")
+    {
+        const std::string filename = "testStorage_multiple_blocks.sto";
+        FileRemover fileRemover(filename);
+        REQUIRE(storage.print(filename));
+        Storage storageRead(filename);
+        REQUIRE(storageRead.getSize() == numRows);
+        for (int i = 0; i < numRows; i += 7) {
+            const StateVector& expected = *storage.getStateVector(i);
+            const StateVector& actual = *storageRead.getStateVector(i);
+            CHECK(actual.getTime() == Catch::Approx(expected.getTime()));
+            for (int j = 0; j < 2; ++j) {
+                CHECK(actual.getData()[j] ==
+                        Catch::Approx(expected.getData()[j]).margin(1e-9));
+            }
+        }
+    }
+
+    SECTION("Uniformly resampled rows")
+    {
+        const std::string filename = "testStorage_multiple_blocks_dt.sto";
+        FileRemover fileRemover(filename);
+        const double dt = 0.0025;
+        REQUIRE(storage.print(filename, dt) > 0);
+        Storage storageRead(filename);
+        REQUIRE(storageRead.getSize() == IO::ComputeNumberOfSteps(
+                storage.getFirstTime(), storage.getLastTime(), dt));
+        for (int i = 0; i < storageRead.getSize(); i += 7) {
+            const StateVector& actual = *storageRead.getStateVector(i);
+            CHECK(actual.getTime() == Catch::Approx(dt * i));
+            double expected[2];
+            storage.getDataAtTime(dt * i, 2, expected);
+            for (int j = 0; j < 2; ++j) {
+                CHECK(actual.getData()[j] ==
+                        Catch::Approx(expected[j]).margin(1e-9));
+            }
+        }
+    }
+
+    IO::SetPrecision(precision);
+}
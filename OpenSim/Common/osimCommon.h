@@ -38,11 +38,14 @@
 #include "LinearFunction.h"
 #include "LoadOpenSimLibrary.h"
 #include "Logger.h"
+#include "MemoryInstrumentation.h"
 #include "ModelDisplayHints.h"
 #include "MultiplierFunction.h"
 #include "MultivariatePolynomialFunction.h"
+#include "MultivariateBSplineFunction.h"
 #include "Object.h"
 #include "ObjectGroup.h"
+#include "Parallel.h"
 #include "PiecewiseConstantFunction.h"
 #include "PiecewiseLinearFunction.h"
 #include "PolynomialFunction.h"
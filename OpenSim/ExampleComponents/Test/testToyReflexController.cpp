@@ -0,0 +1,134 @@
+/* -------------------------------------------------------------------------- *
+ *                  OpenSim:  testToyReflexController.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied    *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/ExampleComponents/ToyReflexController.h>
+#include <OpenSim/ExampleComponents/ToyReflexGainSweep.h>
+
+#include <OpenSim/Actuators/Thelen2003Muscle.h>
+#include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
+
+#include <catch2/catch_all.hpp>
+
+using namespace OpenSim;
+
+namespace {
+    // A block that falls under gravity and stretches the muscle holding it
+    // up, which triggers the reflex.
+    Model createFallingBlockModel() {
+        Model model;
+        model.setName("falling_block");
+        model.setGravity(SimTK::Vec3(-9.81, 0, 0));
+        auto* body = new Body("block", 1.0, SimTK::Vec3(0), SimTK::Inertia(1));
+        model.addComponent(body);
+
+        auto* joint = new SliderJoint("slider", model.getGround(), *body);
+        auto& coord = joint->updCoordinate(SliderJoint::Coord::TranslationX);
+        coord.setName("height");
+        coord.setDefaultValue(-0.15);
+        model.addComponent(joint);
+
+        auto* muscle = new Thelen2003Muscle("muscle", 20.0, 0.1, 0.05, 0.0);
+        muscle->addNewPathPoint("origin", model.updGround(), SimTK::Vec3(0));
+        muscle->addNewPathPoint("insertion", *body, SimTK::Vec3(0));
+        model.addForce(muscle);
+
+        auto* reflex = new ToyReflexController(1.0);
+        reflex->setName("reflex");
+        reflex->addActuator(*muscle);
+        model.addController(reflex);
+        model.finalizeConnections();
+        return model;
+    }
+}
+
+TEST_CASE("ToyReflexController gain in the State") {
+    Model model = createFallingBlockModel();
+    SimTK::State initialState = model.initSystem();
+    model.equilibrateMuscles(initialState);
+    const auto& reflex =
+            model.getComponent<ToyReflexController>("/controllerset/reflex");
+    const auto& coord = model.getCoordinateSet().get("height");
+    CHECK(reflex.getGain(initialState) == 1.0);
+
+    // Each simulation reuses the System created above.
+    auto simulate = [&](double gain) {
+        SimTK::State state = initialState;
+        reflex.setGain(state, gain);
+        CHECK(reflex.getGain(state) == gain);
+        Manager manager(model);
+        manager.setIntegratorAccuracy(1e-6);
+        manager.initialize(state);
+        const SimTK::State& finalState = manager.integrate(0.2);
+        return coord.getValue(finalState);
+    };
+    const double heightWithoutReflex = simulate(0.0);
+    const double heightWithReflex = simulate(20.0);
+    CHECK(heightWithReflex > heightWithoutReflex + 1e-3);
+    CHECK(simulate(0.0) == heightWithoutReflex);
+
+    // The property is only changed through the State when requested.
+    CHECK(reflex.get_gain() == 1.0);
+    SimTK::State state = initialState;
+    reflex.setGain(state, 3.0);
+    model.setPropertiesFromState(state);
+    CHECK(reflex.get_gain() == 3.0);
+}
+
+TEST_CASE("ToyReflexGainSweep") {
+    const double finalTime = 0.2;
+    SimTK::Matrix gainSets(5, 1);
+    for (int i = 0; i < gainSets.nrow(); ++i) gainSets(i, 0) = 5.0 * i;
+
+    ToyReflexGainSweep sweep(createFallingBlockModel(), finalTime);
+    REQUIRE(sweep.getControllerNames() ==
+            std::vector<std::string>{"/controllerset/reflex"});
+    CHECK_THROWS(sweep.setNumThreads(0));
+    CHECK_THROWS(sweep.run(SimTK::Matrix(2, 2)));
+
+    sweep.setNumThreads(3);
+    const DataTable parallel = sweep.run(gainSets);
+    REQUIRE(parallel.getNumRows() == 5);
+    REQUIRE(parallel.getColumnLabels() ==
+            std::vector<std::string>{"/controllerset/reflex", "cost"});
+    const auto parallelGains = parallel.getDependentColumn(
+            "/controllerset/reflex");
+    const auto parallelCosts = parallel.getDependentColumn("cost");
+
+    // Run each gain set on its own, one after the other.
+    sweep.setNumThreads(1);
+    for (int irun = 0; irun < gainSets.nrow(); ++irun) {
+        const DataTable serial =
+                sweep.run(SimTK::Matrix(1, 1, gainSets(irun, 0)));
+        REQUIRE(serial.getNumRows() == 1);
+        const double cost = serial.getDependentColumn("cost")[0];
+        CHECK(parallelGains[irun] == gainSets(irun, 0));
+        CHECK(!SimTK::isNaN(cost));
+        CHECK(parallelCosts[irun] == cost);
+    }
+
+    // The reflex is the only source of controls.
+    CHECK(parallelCosts[0] == 0);
+    for (int irun = 1; irun < gainSets.nrow(); ++irun) {
+        CHECK(parallelCosts[irun] > 0);
+    }
+}
@@ -77,6 +77,34 @@ void ToyReflexController::extendConnectToModel(Model &model)
     }
 }
 
+void ToyReflexController::extendAddToSystem(MultibodySystem& system) const
+{
+    Super::extendAddToSystem(system);
+    addDiscreteVariable("gain", Stage::Instance);
+}
+
+void ToyReflexController::extendInitStateFromProperties(State& s) const
+{
+    Super::extendInitStateFromProperties(s);
+    setGain(s, get_gain());
+}
+
+void ToyReflexController::extendSetPropertiesFromState(const State& s)
+{
+    Super::extendSetPropertiesFromState(s);
+    set_gain(getGain(s));
+}
+
+void ToyReflexController::setGain(State& s, double gain) const
+{
+    setDiscreteVariableValue(s, "gain", gain);
+}
+
+double ToyReflexController::getGain(const State& s) const
+{
+    return getDiscreteVariableValue(s, "gain");
+}
+
 //=============================================================================
 // COMPUTATIONS
 //=============================================================================
@@ -99,6 +127,7 @@ void ToyReflexController::computeControls(const State& s,
     double max_speed = 0;
     //reflex control
     double control = 0;
+    const double gain = getGain(s);
 
     for (int i = 0; i < (int)socket.getNumConnectees(); ++i) {
         const auto& actu = socket.getConnectee(i);
@@ -107,7 +136,7 @@ void ToyReflexController::computeControls(const State& s,
         // un-normalize muscle's maximum contraction velocity (fib_lengths/sec) 
         max_speed =
             musc->getOptimalFiberLength()*musc->getMaxContractionVelocity();
-        control = 0.5*get_gain()*(fabs(speed)+speed)/max_speed;
+        control = 0.5*gain*(fabs(speed)+speed)/max_speed;
 
         SimTK::Vector actControls(1,control);
         // add reflex controls to whatever controls are already in place.
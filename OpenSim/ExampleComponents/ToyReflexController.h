@@ -79,12 +79,29 @@ public:
     void computeControls(const SimTK::State& s,
                          SimTK::Vector &controls) const override;
 
+    /** The gain is also held in the State, initialized from the `gain`
+     * property. Changing it invalidates only SimTK::Stage::Instance, so the
+     * gain can be varied between simulations (e.g., in a parameter sweep)
+     * without re-initializing the System.
+     *
+     * @param s         system state
+     * @param gain      gain on the stretch response
+     */
+    void setGain(SimTK::State& s, double gain) const;
+    /** Get the gain used in the given State. */
+    double getGain(const SimTK::State& s) const;
+
 
 private:
     // Connect properties to local pointers.  */
     void constructProperties();
     // ModelComponent interface to connect this component to its model
     void extendConnectToModel(Model& aModel) override;
+    // ModelComponent interface to allocate and initialize the gain in the
+    // State.
+    void extendAddToSystem(SimTK::MultibodySystem& system) const override;
+    void extendInitStateFromProperties(SimTK::State& s) const override;
+    void extendSetPropertiesFromState(const SimTK::State& s) override;
 
     //=========================================================================
 };  // END of class ToyReflexController
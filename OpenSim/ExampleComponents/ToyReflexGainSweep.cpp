@@ -0,0 +1,156 @@
+/* -------------------------------------------------------------------------- *
+ *                     OpenSim:  ToyReflexGainSweep.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied    *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "ToyReflexGainSweep.h"
+#include "ToyReflexController.h"
+
+#include <OpenSim/Common/Exception.h>
+#include <OpenSim/Common/Parallel.h>
+#include <OpenSim/Simulation/Manager/Manager.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+using namespace OpenSim;
+
+ToyReflexGainSweep::ToyReflexGainSweep(Model model, double finalTime)
+        : m_model(std::move(model)), m_finalTime(finalTime) {
+    m_numThreads = ThreadPool::getDefault().getNumThreads();
+    m_costRate = [](const Model& model, const SimTK::State& state) {
+        return model.getControls(state).normSqr();
+    };
+    m_model.finalizeFromProperties();
+    for (const auto& controller :
+            m_model.getComponentList<ToyReflexController>()) {
+        m_controllerNames.push_back(controller.getAbsolutePathString());
+    }
+    OPENSIM_THROW_IF(m_controllerNames.empty(), Exception,
+            "Expected the model to contain at least one "
+            "ToyReflexController.");
+}
+
+void ToyReflexGainSweep::setNumThreads(int numThreads) {
+    OPENSIM_THROW_IF(numThreads < 1, Exception,
+            "Expected the number of threads to be at least 1, but got {}.",
+            numThreads);
+    m_numThreads = numThreads;
+}
+
+void ToyReflexGainSweep::setReportInterval(double interval) {
+    OPENSIM_THROW_IF(interval <= 0, Exception,
+            "Expected a positive report interval, but got {}.", interval);
+    m_reportInterval = interval;
+}
+
+void ToyReflexGainSweep::setCostRateFunction(CostRateFunction costRate) {
+    OPENSIM_THROW_IF(!costRate, Exception, "Expected a cost rate function.");
+    m_costRate = std::move(costRate);
+}
+
+void ToyReflexGainSweep::setIntegratorAccuracy(double accuracy) {
+    m_integratorAccuracy = accuracy;
+}
+
+DataTable ToyReflexGainSweep::run(const SimTK::Matrix& gainSets) const {
+    const int numControllers = (int)m_controllerNames.size();
+    OPENSIM_THROW_IF(gainSets.ncol() != numControllers, Exception,
+            "Expected one column of gains per ToyReflexController ({}), but "
+            "got {} columns.", numControllers, gainSets.ncol());
+    const int numRuns = gainSets.nrow();
+    const int numThreads = std::max(1, std::min(m_numThreads, numRuns));
+
+    // Each worker owns a model and the equilibrated initial state. Building
+    // the Systems is done up front, in this thread, so that any modeling
+    // errors are reported before any simulations start.
+    struct Worker {
+        std::unique_ptr<Model> model;
+        SimTK::State initialState;
+        std::vector<const ToyReflexController*> controllers;
+    };
+    std::vector<Worker> workers(numThreads);
+    for (auto& worker : workers) {
+        worker.model.reset(m_model.clone());
+        worker.initialState = worker.model->initSystem();
+        worker.model->equilibrateMuscles(worker.initialState);
+        for (const auto& name : m_controllerNames) {
+            worker.controllers.push_back(
+                    &worker.model->getComponent<ToyReflexController>(name));
+        }
+    }
+
+    std::vector<double> costs(numRuns, SimTK::NaN);
+    std::atomic<int> nextRun(0);
+    auto simulate = [&](Worker& worker) {
+        const Model& model = *worker.model;
+        for (int irun = nextRun++; irun < numRuns; irun = nextRun++) {
+            SimTK::State state = worker.initialState;
+            for (int ic = 0; ic < numControllers; ++ic) {
+                worker.controllers[ic]->setGain(state, gainSets(irun, ic));
+            }
+            try {
+                Manager manager(*worker.model);
+                manager.setWriteToStorage(false);
+                manager.setPerformAnalyses(false);
+                manager.setIntegratorAccuracy(m_integratorAccuracy);
+                manager.initialize(state);
+
+                model.realizeDynamics(manager.getState());
+                double prevTime = manager.getState().getTime();
+                double prevRate = m_costRate(model, manager.getState());
+                double cost = 0;
+                while (prevTime < m_finalTime) {
+                    const double time =
+                            std::min(prevTime + m_reportInterval, m_finalTime);
+                    const SimTK::State& current = manager.integrate(time);
+                    model.realizeDynamics(current);
+                    const double rate = m_costRate(model, current);
+                    cost += 0.5 * (rate + prevRate) *
+                            (current.getTime() - prevTime);
+                    prevTime = current.getTime();
+                    prevRate = rate;
+                }
+                costs[irun] = cost;
+            } catch (const std::exception& e) {
+                log_warn("ToyReflexGainSweep: run {} failed: {}", irun,
+                        e.what());
+            }
+        }
+    };
+
+    parallelForChunks(numThreads,
+            [&](int iworker) { simulate(workers[iworker]); }, numThreads);
+
+    DataTable results;
+    std::vector<std::string> labels = m_controllerNames;
+    labels.push_back("cost");
+    results.setColumnLabels(labels);
+    SimTK::RowVector row(numControllers + 1);
+    for (int irun = 0; irun < numRuns; ++irun) {
+        for (int ic = 0; ic < numControllers; ++ic) {
+            row[ic] = gainSets(irun, ic);
+        }
+        row[numControllers] = costs[irun];
+        results.appendRow((double)irun, row);
+    }
+    return results;
+}
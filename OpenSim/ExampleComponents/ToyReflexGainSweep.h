@@ -0,0 +1,113 @@
+#ifndef OPENSIM_TOY_REFLEX_GAIN_SWEEP_H_
+#define OPENSIM_TOY_REFLEX_GAIN_SWEEP_H_
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim: ToyReflexGainSweep.h                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied    *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimExampleComponentsDLL.h"
+#include <OpenSim/Common/DataTable.h>
+#include <OpenSim/Simulation/Model/Model.h>
+
+#include <functional>
+
+namespace OpenSim {
+
+/**
+ * ToyReflexGainSweep runs forward simulations of a model containing
+ * ToyReflexController%s for many sets of reflex gains, in parallel, and
+ * reports a cost for each gain set. This is how one might tune the gains of
+ * a feedback controller by brute force. It is intended for demonstration
+ * purposes only.
+ *
+ * Each worker thread owns its own copy of the model and its System. Gains are
+ * applied to the State with ToyReflexController::setGain(), which invalidates
+ * only SimTK::Stage::Instance, so the System is never re-initialized between
+ * runs.
+ *
+ * The cost of a run is the integral over time of a cost rate, approximated
+ * with the trapezoidal rule at the report interval. By default the cost rate
+ * is the sum of squared model controls (i.e., the cost is muscle effort).
+ *
+ * @code
+ * ToyReflexGainSweep sweep(model, 1.0);
+ * SimTK::Matrix gainSets(10, 1);
+ * for (int i = 0; i < 10; ++i) gainSets(i, 0) = 0.5 * i;
+ * DataTable results = sweep.run(gainSets);
+ * @endcode
+ */
+class OSIMEXAMPLECOMPONENTS_API ToyReflexGainSweep {
+public:
+    /** The cost rate is evaluated on states realized to
+     * SimTK::Stage::Dynamics. */
+    using CostRateFunction =
+            std::function<double(const Model&, const SimTK::State&)>;
+
+    /**
+     * @param model      model containing at least one ToyReflexController
+     * @param finalTime  each run is integrated from the model's initial
+     *                   state (with muscles equilibrated) to this time
+     */
+    ToyReflexGainSweep(Model model, double finalTime);
+
+    /** Number of threads used to run simulations (default: the number of
+     * threads in ThreadPool::getDefault()). */
+    void setNumThreads(int numThreads);
+    int getNumThreads() const { return m_numThreads; }
+
+    /** Interval at which the cost rate is sampled (default: 0.01). */
+    void setReportInterval(double interval);
+    double getReportInterval() const { return m_reportInterval; }
+
+    /** Replace the default (effort) cost rate. The function is called
+     * concurrently from multiple threads, each with its own Model. */
+    void setCostRateFunction(CostRateFunction costRate);
+
+    /** Accuracy of the integrator (default: 1e-5). */
+    void setIntegratorAccuracy(double accuracy);
+
+    /** Names of the ToyReflexController%s in the model, in the order in which
+     * gains are provided to run(). */
+    const std::vector<std::string>& getControllerNames() const {
+        return m_controllerNames;
+    }
+
+    /**
+     * Run one simulation per row of `gainSets`; each row contains one gain per
+     * ToyReflexController (see getControllerNames()). The returned table has
+     * one row per gain set, with the row index as the independent column,
+     * and a column for each controller's gain followed by the column "cost".
+     * If a simulation fails, its cost is NaN.
+     */
+    DataTable run(const SimTK::Matrix& gainSets) const;
+
+private:
+    Model m_model;
+    double m_finalTime;
+    int m_numThreads;
+    double m_reportInterval = 0.01;
+    double m_integratorAccuracy = 1e-5;
+    CostRateFunction m_costRate;
+    std::vector<std::string> m_controllerNames;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_TOY_REFLEX_GAIN_SWEEP_H_
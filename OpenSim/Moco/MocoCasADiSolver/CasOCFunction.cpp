@@ -140,6 +140,7 @@ casadi::Sparsity Function::get_sparsity_in(casadi_int i) {
 }
 
 VectorDM PathConstraint::eval(const VectorDM& args) const {
+    EvalTimer timer(*this);
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5)};
     VectorDM out{casadi::DM(sparsity_out(0))};
@@ -148,6 +149,7 @@ VectorDM PathConstraint::eval(const VectorDM& args) const {
 }
 
 VectorDM CostIntegrand::eval(const VectorDM& args) const {
+    EvalTimer timer(*this);
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5)};
     VectorDM out{casadi::DM(casadi::Sparsity::scalar())};
@@ -156,6 +158,7 @@ VectorDM CostIntegrand::eval(const VectorDM& args) const {
 }
 
 VectorDM EndpointConstraintIntegrand::eval(const VectorDM& args) const {
+    EvalTimer timer(*this);
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
                                    args.at(3), args.at(4), args.at(5)};
     VectorDM out{casadi::DM(casadi::Sparsity::scalar())};
@@ -227,6 +230,7 @@ casadi::DM Endpoint::getSubsetPoint(const VariablesDM& fullPoint,
     }
 }
 VectorDM Cost::eval(const VectorDM& args) const {
+    EvalTimer timer(*this);
     Problem::CostInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5).scalar(), args.at(6), args.at(7),
             args.at(8), args.at(9), args.at(10), args.at(11).scalar()};
@@ -235,6 +239,7 @@ VectorDM Cost::eval(const VectorDM& args) const {
     return out;
 }
 VectorDM EndpointConstraint::eval(const VectorDM& args) const {
+    EvalTimer timer(*this);
     Problem::CostInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5).scalar(), args.at(6), args.at(7),
             args.at(8), args.at(9), args.at(10), args.at(11).scalar()};
@@ -269,6 +274,7 @@ casadi::Sparsity MultibodySystemExplicit<calcKCErr>::get_sparsity_out(
 
 template <bool calcKCErr>
 VectorDM MultibodySystemExplicit<calcKCErr>::eval(const VectorDM& args) const {
+    EvalTimer timer(*this);
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5)};
     VectorDM out((int)n_out());
@@ -326,6 +332,7 @@ casadi::DM VelocityCorrection::getSubsetPoint(
 }
 
 VectorDM VelocityCorrection::eval(const VectorDM& args) const {
+    EvalTimer timer(*this);
     VectorDM out{casadi::DM(sparsity_out(0))};
     m_casProblem->calcVelocityCorrection(
             args.at(0).scalar(), args.at(1), args.at(2), args.at(3), out[0]);
@@ -375,6 +382,7 @@ casadi::DM StateProjection::getSubsetPoint(
 }
 
 VectorDM StateProjection::eval(const VectorDM& args) const {
+    EvalTimer timer(*this);
     VectorDM out{casadi::DM(sparsity_out(0))};
     m_casProblem->calcStateProjection(
             args.at(0).scalar(), args.at(1), args.at(2), args.at(3), out[0]);
@@ -407,6 +415,7 @@ casadi::Sparsity MultibodySystemImplicit<calcKCErr>::get_sparsity_out(
 
 template <bool calcKCErr>
 VectorDM MultibodySystemImplicit<calcKCErr>::eval(const VectorDM& args) const {
+    EvalTimer timer(*this);
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5)};
     VectorDM out((int)n_out());
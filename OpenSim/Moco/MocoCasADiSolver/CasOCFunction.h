@@ -21,6 +21,8 @@
 #include "CasOCIterate.h"
 
 #include <OpenSim/Common/Exception.h>
+#include <atomic>
+#include <chrono>
 
 namespace CasOC {
 
@@ -64,7 +66,33 @@ public:
     casadi::Sparsity get_jac_sparsity(casadi_int oind, casadi_int iind,
             bool symmetric) const override;
 
+    /// The number of times eval() has been called, including the calls CasADi
+    /// makes to compute finite-difference derivatives.
+    long long getNumEvals() const { return m_numEvals.load(); }
+    /// The wall-clock time, in nanoseconds, spent in eval(), summed over all
+    /// threads that called it.
+    long long getEvalTimeNs() const { return m_evalTimeNs.load(); }
+
 protected:
+    /// Create one of these at the start of eval() to count and time the call.
+    class EvalTimer {
+    public:
+        explicit EvalTimer(const Function& function)
+                : m_function(function),
+                  m_start(std::chrono::steady_clock::now()) {}
+        ~EvalTimer() {
+            const auto elapsed = std::chrono::steady_clock::now() - m_start;
+            m_function.m_numEvals.fetch_add(1);
+            m_function.m_evalTimeNs.fetch_add(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            elapsed).count());
+        }
+
+    private:
+        const Function& m_function;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
     const Problem* m_casProblem;
 
 private:
@@ -108,6 +136,10 @@ private:
 
     std::shared_ptr<const std::vector<VariablesDM>>
             m_fullPointsForSparsityDetection;
+
+    // eval() may be called from several threads at once.
+    mutable std::atomic<long long> m_numEvals{0};
+    mutable std::atomic<long long> m_evalTimeNs{0};
 };
 
 class PathConstraint : public Function {
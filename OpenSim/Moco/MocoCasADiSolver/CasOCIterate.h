@@ -72,6 +72,14 @@ struct Iterate {
                      bool appendProjectionStates) const;
 };
 
+/// The number of evaluations of one type of CasOC::Function (e.g.,
+/// "multibody_system") and the time spent in them, summed over threads.
+struct FunctionEvalStats {
+    std::string name;
+    long long num_evals = 0;
+    long long time_ns = 0;
+};
+
 /// This struct is used to return a solution to a problem. Use `stats`
 /// to check if the problem converged.
 using ObjectiveBreakdown = std::vector<std::pair<std::string, double>>;
@@ -79,6 +87,13 @@ struct Solution : public Iterate {
     casadi::Dict stats;
     double objective;
     ObjectiveBreakdown objective_breakdown;
+    /// Function evaluations over the whole solve.
+    std::vector<FunctionEvalStats> function_evals;
+    /// The wall-clock time (seconds) of each optimizer iteration, and the
+    /// function evaluations made during each iteration. Entry 0 covers the
+    /// work done before the first iteration.
+    std::vector<double> iteration_wall_times;
+    std::vector<std::vector<FunctionEvalStats>> iteration_function_evals;
 };
 
 } // namespace CasOC
@@ -52,4 +52,35 @@ Problem::createKinematicConstraintEquationNamesImpl() const {
     return names;
 }
 
+std::vector<FunctionEvalStats> Problem::getFunctionEvalStats() const {
+    std::vector<FunctionEvalStats> stats(6);
+    stats[0].name = "multibody_system";
+    stats[1].name = "velocity_correction";
+    stats[2].name = "state_projection";
+    stats[3].name = "path_constraint";
+    stats[4].name = "goal_integrand";
+    stats[5].name = "goal_endpoint";
+    auto add = [](FunctionEvalStats& total, const Function* function) {
+        if (!function) return;
+        total.num_evals += function->getNumEvals();
+        total.time_ns += function->getEvalTimeNs();
+    };
+    add(stats[0], m_multibodyFunc.get());
+    add(stats[0], m_multibodyFuncIgnoringConstraints.get());
+    add(stats[0], m_implicitMultibodyFunc.get());
+    add(stats[0], m_implicitMultibodyFuncIgnoringConstraints.get());
+    add(stats[1], m_velocityCorrectionFunc.get());
+    add(stats[2], m_stateProjectionFunc.get());
+    for (const auto& info : m_pathInfos) add(stats[3], info.function.get());
+    for (const auto& info : m_costInfos) {
+        add(stats[4], info.integrand_function.get());
+        add(stats[5], info.endpoint_function.get());
+    }
+    for (const auto& info : m_endpointConstraintInfos) {
+        add(stats[4], info.integrand_function.get());
+        add(stats[5], info.endpoint_function.get());
+    }
+    return stats;
+}
+
 } // namespace CasOC
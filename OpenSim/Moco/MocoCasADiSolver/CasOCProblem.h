@@ -674,6 +674,12 @@ public:
     getImplicitMultibodySystemIgnoringConstraints() const {
         return *m_implicitMultibodyFuncIgnoringConstraints;
     }
+    /// Get the number of evaluations of the functions above (and of the
+    /// goal and path constraint functions), and the time spent in them,
+    /// summed by type of function: "multibody_system", "velocity_correction",
+    /// "state_projection", "path_constraint", "goal_integrand" and
+    /// "goal_endpoint". The counts accumulate over the life of the problem.
+    std::vector<FunctionEvalStats> getFunctionEvalStats() const;
     /// @}
 
 private:
@@ -17,6 +17,8 @@
  * -------------------------------------------------------------------------- */
 #include "CasOCTranscription.h"
 
+#include <chrono>
+
 using casadi::DM;
 using casadi::MX;
 using casadi::MXVector;
@@ -24,6 +26,17 @@ using casadi::Slice;
 
 namespace CasOC {
 
+/// Return the function evaluations in `after` that were not yet in `before`.
+static std::vector<FunctionEvalStats> subtractFunctionEvals(
+        std::vector<FunctionEvalStats> after,
+        const std::vector<FunctionEvalStats>& before) {
+    for (int i = 0; i < (int)after.size(); ++i) {
+        after[i].num_evals -= before[i].num_evals;
+        after[i].time_ns -= before[i].time_ns;
+    }
+    return after;
+}
+
 // http://casadi.sourceforge.net/api/html/d7/df0/solvers_2callback_8py-example.html
 
 /// This class allows us to observe intermediate iterates throughout the
@@ -56,7 +69,27 @@ public:
             return casadi::Sparsity(0, 0);
         }
     }
+    /// Call this immediately before running the optimization so that the
+    /// profile of the first iteration does not include setup work (e.g.,
+    /// sparsity detection).
+    void start() {
+        m_iterationStart = std::chrono::steady_clock::now();
+        m_functionEvalsAtIterationStart = m_problem.getFunctionEvalStats();
+        m_iterationWallTimes.clear();
+        m_iterationFunctionEvals.clear();
+    }
+    /// The wall-clock time of each iteration (seconds), measured between
+    /// calls to this callback.
+    const std::vector<double>& getIterationWallTimes() const {
+        return m_iterationWallTimes;
+    }
+    /// The function evaluations made during each iteration.
+    const std::vector<std::vector<FunctionEvalStats>>&
+    getIterationFunctionEvals() const {
+        return m_iterationFunctionEvals;
+    }
     std::vector<DM> eval(const std::vector<DM>& args) const override {
+        recordIterationProfile();
         if (m_callbackInterval > 0 && evalCount % m_callbackInterval == 0) {
             Iterate iterate = m_problem.createIterate<Iterate>();
             iterate.variables = m_transcription.expandVariables(args.at(0));
@@ -78,6 +111,22 @@ private:
     casadi_int m_numConstraints;
     casadi_int m_callbackInterval;
     mutable int evalCount = 0;
+
+    void recordIterationProfile() const {
+        const auto now = std::chrono::steady_clock::now();
+        m_iterationWallTimes.push_back(
+                std::chrono::duration<double>(now - m_iterationStart).count());
+        auto functionEvals = m_problem.getFunctionEvalStats();
+        m_iterationFunctionEvals.push_back(subtractFunctionEvals(
+                functionEvals, m_functionEvalsAtIterationStart));
+        m_iterationStart = now;
+        m_functionEvalsAtIterationStart = std::move(functionEvals);
+    }
+    mutable std::chrono::steady_clock::time_point m_iterationStart;
+    mutable std::vector<FunctionEvalStats> m_functionEvalsAtIterationStart;
+    mutable std::vector<double> m_iterationWallTimes;
+    mutable std::vector<std::vector<FunctionEvalStats>>
+            m_iterationFunctionEvals;
 };
 
 void Transcription::createVariablesAndSetBounds(const casadi::DM& grid,
@@ -1071,12 +1120,15 @@ Solution Transcription::solve(const Iterate& guessOrig) {
     // Run the optimization (evaluate the CasADi NLP function).
     // --------------------------------------------------------
     // The inputs and outputs of nlpFunc are numeric (casadi::DM).
+    const auto functionEvalsBeforeSolve = m_problem.getFunctionEvalStats();
+    callback.start();
     const casadi::DMDict nlpResult = nlpFunc(casadi::DMDict{
                     {"x0", flattenVariables(scaleVariables(guess.variables))},
                     {"lbx", flattenVariables(scaleVariables(m_lowerBounds))},
                     {"ubx", flattenVariables(scaleVariables(m_upperBounds))},
                     {"lbg", flattenConstraints(m_constraintsLowerBounds)},
                     {"ubg", flattenConstraints(m_constraintsUpperBounds)}});
+    const auto functionEvalsAfterSolve = m_problem.getFunctionEvalStats();
 
     // Create a CasOC::Solution.
     // -------------------------
@@ -1094,6 +1146,10 @@ Solution Transcription::solve(const Iterate& guessOrig) {
     solution.times = createTimes(
             solution.variables[initial_time], solution.variables[final_time]);
     solution.stats = nlpFunc.stats();
+    solution.function_evals = subtractFunctionEvals(
+            functionEvalsAfterSolve, functionEvalsBeforeSolve);
+    solution.iteration_wall_times = callback.getIterationWallTimes();
+    solution.iteration_function_evals = callback.getIterationFunctionEvals();
 
     // Print breakdown of objective.
     printObjectiveBreakdown(solution, objectiveOut[0]);
@@ -38,6 +38,121 @@
 
 using namespace OpenSim;
 
+#ifdef OPENSIM_WITH_CASADI
+namespace {
+/// Create the tables described in MocoSolution::getSolverIterationProfile()
+/// and MocoSolution::getSolverProfile().
+std::pair<TimeSeriesTable, TimeSeriesTable> createSolverProfile(
+        const CasOC::Solution& casSolution, int numThreads) {
+    // Per-iteration profile.
+    // ----------------------
+    const int numIterations = (int)casSolution.iteration_wall_times.size();
+    std::vector<std::string> labels{"wall_time"};
+    std::vector<std::vector<double>> columns{casSolution.iteration_wall_times};
+    if (numIterations) {
+        const auto& first = casSolution.iteration_function_evals.front();
+        for (int ifunc = 0; ifunc < (int)first.size(); ++ifunc) {
+            std::vector<double> evals(numIterations);
+            std::vector<double> times(numIterations);
+            for (int iiter = 0; iiter < numIterations; ++iiter) {
+                const auto& entry =
+                        casSolution.iteration_function_evals[iiter][ifunc];
+                evals[iiter] = (double)entry.num_evals;
+                times[iiter] = SimTK::nsToSec(entry.time_ns);
+            }
+            labels.push_back(first[ifunc].name + "_evals");
+            columns.push_back(std::move(evals));
+            labels.push_back(first[ifunc].name + "_time");
+            columns.push_back(std::move(times));
+        }
+    }
+    // Include the optimizer's own per-iteration measures (IPOPT provides
+    // these), as long as there is one value per iteration.
+    if (casSolution.stats.count("iterations") &&
+            casSolution.stats.at("iterations").is_dict()) {
+        const Dict& iterations = casSolution.stats.at("iterations").as_dict();
+        for (const auto& entry : iterations) {
+            if (!entry.second.is_double_vector()) continue;
+            std::vector<double> values = entry.second.to_double_vector();
+            if ((int)values.size() != numIterations) continue;
+            labels.push_back(entry.first);
+            columns.push_back(std::move(values));
+        }
+    }
+    std::vector<double> iterationIndices(numIterations);
+    SimTK::Matrix iterationData(numIterations, (int)columns.size());
+    for (int iiter = 0; iiter < numIterations; ++iiter) {
+        iterationIndices[iiter] = iiter;
+        for (int icol = 0; icol < (int)columns.size(); ++icol) {
+            iterationData(iiter, icol) = columns[icol][iiter];
+        }
+    }
+    TimeSeriesTable iterationProfile(
+            iterationIndices, iterationData, labels);
+
+    // Summary of the entire solve.
+    // ----------------------------
+    std::vector<std::string> summaryLabels;
+    std::vector<double> summary;
+    // CasADi reports n_call_<name>, t_wall_<name>, and t_proc_<name> for each
+    // function the optimizer calls, plus "total".
+    double optimizerWallTime = 0;
+    double nlpFunctionWallTime = 0;
+    for (const auto& entry : casSolution.stats) {
+        const std::string& key = entry.first;
+        if (key.compare(0, 7, "n_call_") != 0) continue;
+        const std::string name = key.substr(7);
+        const std::string wallKey = "t_wall_" + name;
+        const std::string procKey = "t_proc_" + name;
+        if (!casSolution.stats.count(wallKey) ||
+                !casSolution.stats.count(procKey)) {
+            continue;
+        }
+        const double wallTime = casSolution.stats.at(wallKey).to_double();
+        summaryLabels.push_back(name + "_evals");
+        summary.push_back((double)entry.second.to_int());
+        summaryLabels.push_back(name + "_wall_time");
+        summary.push_back(wallTime);
+        summaryLabels.push_back(name + "_proc_time");
+        summary.push_back(casSolution.stats.at(procKey).to_double());
+        if (name == "total") {
+            optimizerWallTime += wallTime;
+        } else if (name.compare(0, 4, "nlp_") == 0) {
+            // The callback that records intermediate iterates is not an
+            // nlp_ function and its time counts toward the optimizer.
+            nlpFunctionWallTime += wallTime;
+            optimizerWallTime -= wallTime;
+        }
+    }
+    summaryLabels.push_back("optimizer_wall_time");
+    summary.push_back(std::max(0.0, optimizerWallTime));
+    double openSimFunctionTime = 0;
+    for (const auto& entry : casSolution.function_evals) {
+        summaryLabels.push_back(entry.name + "_evals");
+        summary.push_back((double)entry.num_evals);
+        summaryLabels.push_back(entry.name + "_time");
+        summary.push_back(SimTK::nsToSec(entry.time_ns));
+        openSimFunctionTime += SimTK::nsToSec(entry.time_ns);
+    }
+    summaryLabels.push_back("num_threads");
+    summary.push_back(numThreads);
+    summaryLabels.push_back("thread_utilization");
+    summary.push_back(nlpFunctionWallTime > 0
+                              ? std::min(1.0, openSimFunctionTime /
+                                                (numThreads *
+                                                        nlpFunctionWallTime))
+                              : SimTK::NaN);
+    SimTK::Matrix summaryData(1, (int)summary.size());
+    for (int icol = 0; icol < (int)summary.size(); ++icol) {
+        summaryData(0, icol) = summary[icol];
+    }
+    TimeSeriesTable profile(std::vector<double>{0}, summaryData,
+            summaryLabels);
+    return {std::move(iterationProfile), std::move(profile)};
+}
+} // anonymous namespace
+#endif
+
 MocoCasADiSolver::MocoCasADiSolver() { constructProperties(); }
 
 void MocoCasADiSolver::constructProperties() {
@@ -48,6 +163,7 @@ void MocoCasADiSolver::constructProperties() {
     constructProperty_optim_finite_difference_scheme("central");
     constructProperty_parallel();
     constructProperty_output_interval(0);
+    constructProperty_output_format("sto");
 
     constructProperty_minimize_implicit_multibody_accelerations(false);
     constructProperty_implicit_multibody_accelerations_weight(1.0);
@@ -173,6 +289,7 @@ std::unique_ptr<MocoCasOCProblem> MocoCasADiSolver::createCasOCProblem() const {
 
     checkPropertyValueIsInSet(
             getProperty_multibody_dynamics_mode(), {"explicit", "implicit"});
+    checkPropertyValueIsInSet(getProperty_output_format(), {"sto", "binary"});
     if (problemRep.isPrescribedKinematics()) {
         OPENSIM_THROW_IF(get_multibody_dynamics_mode() != "implicit", Exception,
                 "Prescribed kinematics (PositionMotion) requires implicit "
@@ -408,6 +525,7 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
         OPENSIM_THROW_FRMOBJ(Exception, "MocoCasADiSolver failed internally.");
     }
     OpenSim::Logger::setLevel(origLoggerLevel);
+    casProblem->finishWritingIterates();
 
     MocoSolution mocoSolution = convertToMocoTrajectory<MocoSolution>(
             casSolution, inputControlIndexes);
@@ -427,6 +545,10 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
             casSolution.objective, casSolution.stats.at("return_status"),
             casSolution.stats.at("iter_count"), SimTK::nsToSec(elapsed),
             casSolution.objective_breakdown);
+    auto solverProfile =
+            createSolverProfile(casSolution, casProblem->getJarSize());
+    setSolutionProfile(mocoSolution, std::move(solverProfile.first),
+            std::move(solverProfile.second));
 
     if (get_verbosity()) {
         log_info(std::string(72, '-'));
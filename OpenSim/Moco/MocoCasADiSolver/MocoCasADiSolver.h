@@ -153,7 +153,12 @@ public:
             "Write intermediate trajectories to file. 0, the default, "
             "indicates no intermediate trajectories are saved, 1 indicates "
             "each iteration is saved, 5 indicates every fifth iteration is "
-            "saved, etc.");
+            "saved, etc. Files are written on a background thread; if the "
+            "solver outpaces the disk, older iterates are skipped.");
+    OpenSim_DECLARE_PROPERTY(output_format, std::string,
+            "The format of the intermediate trajectory files written with "
+            "'output_interval': 'sto' (default) or 'binary' (see "
+            "MocoTrajectory::writeBinary()), which is faster to write.");
 
     OpenSim_DECLARE_PROPERTY(minimize_implicit_multibody_accelerations, bool,
             "Minimize the integral of the squared acceleration continuous "
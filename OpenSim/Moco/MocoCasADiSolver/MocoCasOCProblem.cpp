@@ -284,4 +284,19 @@ MocoCasOCProblem::MocoCasOCProblem(const MocoCasADiSolver& mocoCasADiSolver,
     m_fileDeletionThrower = OpenSim::make_unique<FileDeletionThrower>(
             fmt::format("delete_this_to_stop_optimization_{}_{}.txt",
                     problemRep.getName(), m_formattedTimeString));
+    if (mocoCasADiSolver.get_output_interval() > 0) {
+        m_iterateWriter = OpenSim::make_unique<MocoIterateWriter>(
+                mocoCasADiSolver.get_output_format() == "binary");
+    }
+}
+
+void MocoCasOCProblem::finishWritingIterates() const {
+    if (!m_iterateWriter) return;
+    m_iterateWriter->flush();
+    if (m_iterateWriter->getNumSkipped()) {
+        log_info("Wrote {} intermediate trajectories; skipped {} because "
+                 "they could not be written as fast as they were produced.",
+                m_iterateWriter->getNumWritten(),
+                m_iterateWriter->getNumSkipped());
+    }
 }
@@ -25,6 +25,7 @@
 #include <OpenSim/Moco/Components/ControlDistributor.h>
 #include <OpenSim/Moco/Components/DiscreteForces.h>
 #include <OpenSim/Moco/MocoBounds.h>
+#include <OpenSim/Moco/MocoIterateWriter.h>
 #include <OpenSim/Moco/MocoProblemRep.h>
 
 namespace OpenSim {
@@ -313,6 +314,10 @@ public:
 
     int getJarSize() const { return (int)m_jar->size(); }
 
+    /// Wait until the intermediate trajectories requested with
+    /// MocoCasADiSolver's output_interval property have been written.
+    void finishWritingIterates() const;
+
 private:
     void calcMultibodySystemExplicit(const ContinuousInput& input,
             bool calcKCErrors,
@@ -643,10 +648,13 @@ private:
     }
     void intermediateCallbackWithIterateImpl(
             const CasOC::Iterate& iterate) const override {
+        // Writing happens on a background thread so the optimizer does not
+        // wait for the disk.
         std::string filename =
-                fmt::format("MocoCasADiSolver_{}_trajectory{:06d}.sto",
-                        m_formattedTimeString, iterate.iteration);
-        convertToMocoTrajectory(iterate).write(filename);
+                fmt::format("MocoCasADiSolver_{}_trajectory{:06d}.{}",
+                        m_formattedTimeString, iterate.iteration,
+                        m_iterateWriter->isBinary() ? "bin" : "sto");
+        m_iterateWriter->write(convertToMocoTrajectory(iterate), filename);
     }
 
 private:
@@ -877,6 +885,7 @@ private:
     std::string m_formattedTimeString;
     std::unordered_map<int, int> m_yIndexMap;
     std::unique_ptr<FileDeletionThrower> m_fileDeletionThrower;
+    std::unique_ptr<MocoIterateWriter> m_iterateWriter;
     // Local memory to hold constraint forces.
     static thread_local SimTK::Vector_<SimTK::SpatialVec>
             m_constraintBodyForces;
@@ -26,8 +26,28 @@
 #include "MocoStudy.h"
 #include "MocoUtilities.h"
 
+#include <OpenSim/Common/Parallel.h>
+#include <OpenSim/Common/Stopwatch.h>
+
+#include <algorithm>
+
 using namespace OpenSim;
 
+namespace {
+/// Linearly interpolate the trajectory `values` (with times `time`) at time
+/// `t`; times outside the trajectory use the nearest endpoint.
+double interpolateAt(const SimTK::Vector& time,
+        const SimTK::VectorView& values, double t) {
+    const int n = time.size();
+    if (t <= time[0]) return values[0];
+    if (t >= time[n - 1]) return values[n - 1];
+    const double* begin = &time[0];
+    const int i = (int)(std::upper_bound(begin, begin + n, t) - begin);
+    const double s = (t - time[i - 1]) / (time[i] - time[i - 1]);
+    return (1 - s) * values[i - 1] + s * values[i];
+}
+} // anonymous namespace
+
 void MocoInverse::constructProperties() {
 
     constructProperty_kinematics(TableProcessor());
@@ -38,6 +58,10 @@ void MocoInverse::constructProperties() {
     constructProperty_constraint_tolerance(1e-3);
     constructProperty_output_paths();
     constructProperty_reserves_weight(1.0);
+    constructProperty_window_duration();
+    constructProperty_window_overlap(0.1);
+    constructProperty_window_boundary_passes(1);
+    constructProperty_num_parallel_windows(0);
 }
 
 MocoStudy MocoInverse::initialize() const { return initializeInternal().first; }
@@ -125,11 +149,18 @@ MocoInverseSolution MocoInverse::solve() const {
     std::pair<MocoStudy, TimeSeriesTable> init = initializeInternal();
     const auto& study = init.first;
 
-    MocoSolution mocoSolution = study.solve().unseal();
+    MocoInverseSolution solution;
+    MocoSolution mocoSolution;
+    if (getProperty_window_duration().empty()) {
+        mocoSolution = study.solve().unseal();
+    } else {
+        TimeSeriesTable boundaryResiduals;
+        mocoSolution = solveWindows(study, boundaryResiduals);
+        solution.setWindowBoundaryResiduals(std::move(boundaryResiduals));
+    }
 
     const auto& statesTrajTable = init.second;
     mocoSolution.insertStatesTrajectory(statesTrajTable);
-    MocoInverseSolution solution;
     solution.setMocoSolution(mocoSolution);
 
     if (getProperty_output_paths().size()) {
@@ -145,3 +176,193 @@ MocoInverseSolution MocoInverse::solve() const {
     }
     return solution;
 }
+
+MocoSolution MocoInverse::solveWindows(const MocoStudy& study,
+        TimeSeriesTable& boundaryResiduals) const {
+    OPENSIM_THROW_IF_FRMOBJ(get_window_duration() <= 0, Exception,
+            "Expected window_duration to be positive, but got {}.",
+            get_window_duration());
+    OPENSIM_THROW_IF_FRMOBJ(get_window_overlap() < 0, Exception,
+            "Expected window_overlap to be non-negative, but got {}.",
+            get_window_overlap());
+    OPENSIM_THROW_IF_FRMOBJ(get_window_boundary_passes() < 0, Exception,
+            "Expected window_boundary_passes to be non-negative, but got {}.",
+            get_window_boundary_passes());
+    OPENSIM_THROW_IF_FRMOBJ(get_num_parallel_windows() < 0, Exception,
+            "Expected num_parallel_windows to be non-negative, but got {}.",
+            get_num_parallel_windows());
+    const Stopwatch stopwatch;
+
+    const auto& phase = study.getProblem().getPhase();
+    const double initialTime = phase.getTimeInitialBounds().getLower();
+    const double finalTime = phase.getTimeFinalBounds().getUpper();
+    const int numWindows = std::max(1,
+            (int)std::round((finalTime - initialTime) / get_window_duration()));
+    if (numWindows == 1) return study.solve().unseal();
+
+    // Window w keeps the solution in [kept[w], kept[w + 1]], and is solved
+    // over that interval extended by window_overlap on both sides.
+    std::vector<double> kept(numWindows + 1);
+    for (int w = 0; w <= numWindows; ++w) {
+        kept[w] = initialTime + w * (finalTime - initialTime) / numWindows;
+    }
+    const int numThreads = get_num_parallel_windows() == 0
+                                   ? ThreadPool::getDefault().getNumThreads()
+                                   : get_num_parallel_windows();
+    log_info("MocoInverse: solving {} windows of {} s, overlapping by {} s.",
+            numWindows, (finalTime - initialTime) / numWindows,
+            get_window_overlap());
+
+    std::vector<MocoSolution> windows(numWindows);
+    std::vector<MocoSolution> previousPass;
+    int numIterations = 0;
+    for (int pass = 0; pass <= get_window_boundary_passes(); ++pass) {
+        // The first window has a known initial state, so only the first pass
+        // solves it.
+        const int firstWindow = pass == 0 ? 0 : 1;
+        parallelFor(firstWindow, numWindows, [&](int w) {
+            const double start =
+                    std::max(initialTime, kept[w] - get_window_overlap());
+            const double end =
+                    std::min(finalTime, kept[w + 1] + get_window_overlap());
+            MocoStudy windowStudy = study;
+            auto& problem = windowStudy.updProblem();
+            problem.setTimeBounds(start, end);
+            if (w > 0) {
+                problem.updGoal("initial_activation").setEnabled(false);
+            }
+            if (pass > 0) {
+                // Start where the preceding window was at this time.
+                const auto& preceding = previousPass[w - 1];
+                for (const auto& name : preceding.getStateNames()) {
+                    problem.setStateInfo(name, {},
+                            interpolateAt(preceding.getTime(),
+                                    preceding.getState(name), start));
+                }
+            }
+            auto& solver = windowStudy.updSolver<MocoCasADiSolver>();
+            solver.set_num_mesh_intervals(std::max(1,
+                    (int)std::ceil((end - start) / get_mesh_interval())));
+            if (numThreads > 1) solver.set_parallel(0);
+            if (pass > 0) solver.setGuess(previousPass[w]);
+            windows[w] = windowStudy.solve().unseal();
+        }, numThreads);
+        for (int w = firstWindow; w < numWindows; ++w) {
+            numIterations += windows[w].getNumIterations();
+        }
+        previousPass = windows;
+    }
+
+    // Stitch the kept portions of the windows.
+    // ----------------------------------------
+    std::vector<std::vector<int>> rows(numWindows);
+    int numTimes = 0;
+    for (int w = 0; w < numWindows; ++w) {
+        const auto& time = windows[w].getTime();
+        for (int i = 0; i < time.size(); ++i) {
+            if (time[i] < kept[w]) continue;
+            if (time[i] > kept[w + 1]) break;
+            if (time[i] == kept[w + 1] && w + 1 < numWindows) break;
+            rows[w].push_back(i);
+        }
+        numTimes += (int)rows[w].size();
+    }
+    auto stitch = [&](const std::function<SimTK::Vector(
+                              const MocoTrajectory&)>& getColumn) {
+        SimTK::Vector column(numTimes);
+        int itime = 0;
+        for (int w = 0; w < numWindows; ++w) {
+            const SimTK::Vector values = getColumn(windows[w]);
+            for (int i : rows[w]) column[itime++] = values[i];
+        }
+        return column;
+    };
+
+    MocoSolution solution = windows[0];
+    solution.setNumTimes(numTimes);
+    solution.setTime(stitch([](const MocoTrajectory& window) {
+        return window.getTime();
+    }));
+    for (const auto& name : solution.getStateNames()) {
+        solution.setState(name, stitch([&](const MocoTrajectory& window) {
+            return window.getState(name);
+        }));
+    }
+    for (const auto& name : solution.getControlNames()) {
+        solution.setControl(name, stitch([&](const MocoTrajectory& window) {
+            return window.getControl(name);
+        }));
+    }
+    for (const auto& name : solution.getInputControlNames()) {
+        solution.setInputControl(name,
+                stitch([&](const MocoTrajectory& window) {
+                    return window.getInputControl(name);
+                }));
+    }
+    for (const auto& name : solution.getMultiplierNames()) {
+        solution.setMultiplier(name,
+                stitch([&](const MocoTrajectory& window) {
+                    return window.getMultiplier(name);
+                }));
+    }
+    for (const auto& name : solution.getDerivativeNames()) {
+        solution.setDerivative(name,
+                stitch([&](const MocoTrajectory& window) {
+                    return window.getDerivative(name);
+                }));
+    }
+    for (const auto& name : solution.getSlackNames()) {
+        solution.setSlack(name, stitch([&](const MocoTrajectory& window) {
+            return window.getSlack(name);
+        }));
+    }
+
+    bool success = true;
+    int numSucceeded = 0;
+    double objective = 0;
+    for (const auto& window : windows) {
+        if (window.success()) ++numSucceeded;
+        success = success && window.success();
+        objective += window.getObjective();
+    }
+    solution.setSuccess(success);
+    // MocoInverse::solve() seals a failed solution after adding kinematics.
+    solution.unseal();
+    solution.setStatus(fmt::format("{} of {} windows succeeded.",
+            numSucceeded, numWindows));
+    solution.setObjective(objective);
+    solution.setObjectiveBreakdown({});
+    solution.setNumIterations(numIterations);
+    solution.setSolverDuration(stopwatch.getElapsedTime());
+    solution.setSolverProfile({}, {});
+
+    // Compare neighboring windows at their shared boundary.
+    // -----------------------------------------------------
+    std::vector<std::string> labels = solution.getStateNames();
+    labels.insert(labels.end(), solution.getControlNames().begin(),
+            solution.getControlNames().end());
+    const int numStates = solution.getNumStates();
+    std::vector<double> boundaryTimes;
+    SimTK::Matrix residuals(numWindows - 1, (int)labels.size());
+    for (int w = 1; w < numWindows; ++w) {
+        const double t = kept[w];
+        boundaryTimes.push_back(t);
+        const auto& left = windows[w - 1];
+        const auto& right = windows[w];
+        for (int i = 0; i < (int)labels.size(); ++i) {
+            const auto& name = labels[i];
+            const bool isState = i < numStates;
+            const double leftValue = interpolateAt(left.getTime(),
+                    isState ? left.getState(name) : left.getControl(name), t);
+            const double rightValue = interpolateAt(right.getTime(),
+                    isState ? right.getState(name) : right.getControl(name),
+                    t);
+            residuals(w - 1, i) = std::abs(leftValue - rightValue);
+        }
+    }
+    boundaryResiduals = TimeSeriesTable(boundaryTimes, residuals, labels);
+    log_info("MocoInverse: largest difference between windows at a boundary: "
+             "{}.", residuals.nelt() ? SimTK::max(SimTK::max(residuals)) : 0.0);
+
+    return solution;
+}
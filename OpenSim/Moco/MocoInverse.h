@@ -36,6 +36,16 @@ class MocoInverseSolution {
 public:
     const MocoSolution& getMocoSolution() const { return m_mocoSolution; }
     const TimeSeriesTable& getOutputs() const { return m_outputs; }
+    /// If the problem was solved in time windows (see MocoInverse's
+    /// window_duration property), this table has one row for each boundary
+    /// between neighboring windows (the independent column is the time of the
+    /// boundary) and one column for each state and control. Each entry is the
+    /// absolute difference between the two windows' values at the boundary;
+    /// large values indicate that the windows should overlap more. The table
+    /// is empty if the problem was not windowed.
+    const TimeSeriesTable& getWindowBoundaryResiduals() const {
+        return m_windowBoundaryResiduals;
+    }
 private:
     void setMocoSolution(MocoSolution mocoSolution) {
         m_mocoSolution = std::move(mocoSolution);
@@ -43,8 +53,12 @@ private:
     void setOutputs(TimeSeriesTable outputs) {
         m_outputs = std::move(outputs);
     }
+    void setWindowBoundaryResiduals(TimeSeriesTable residuals) {
+        m_windowBoundaryResiduals = std::move(residuals);
+    }
     MocoSolution m_mocoSolution;
     TimeSeriesTable m_outputs;
+    TimeSeriesTable m_windowBoundaryResiduals;
     friend class MocoInverse;
 };
 
@@ -140,6 +154,33 @@ solution.write("MocoInverse_solution.sto");
 Do NOT change the multibody_dynamics_mode solver setting, as setting this to
 "implicit" is vital to how MocoInverse works.
 
+# Time windows
+For long trials (e.g., walking bouts of many seconds), solving one large
+problem can be slow. Because the muscle states (activations, tendon forces)
+are the only quantities that couple points in time, you can instead set the
+window_duration property to split the time range into windows of roughly this
+duration. Each window is extended by window_overlap on both sides, and the
+windows are solved at the same time (see num_parallel_windows). The extended
+portions are discarded and the remaining portions are stitched into a single
+MocoSolution.
+
+Each window after the first is then solved again, with its initial muscle
+states set to the first-pass solution of the preceding window (disable this
+with window_boundary_passes). This makes neighboring windows agree at their
+boundary; MocoInverseSolution::getWindowBoundaryResiduals() reports how
+closely they agree. The initial_activation goal applies only to the first
+window.
+
+@code
+inverse.set_window_duration(2.0);
+inverse.set_window_overlap(0.2);
+@endcode
+
+When more than one window is solved at a time, each window's solver runs
+serially (MocoCasADiSolver's `parallel` property is set to 0). The objective
+of the stitched MocoSolution is the sum of the windows' objectives. Custom
+problems obtained from initialize() are not windowed.
+
 # Path constraints
 If adding a MocoPathConstraint to a custom MocoInverse problem, you may want
 to enable the solver setting 'enforce_path_constraint_midpoints':
@@ -192,6 +233,26 @@ public:
             "the model operator ModOpAddReserves, which names each appended "
             "actuator in this format. Default weight: 1.");
 
+    OpenSim_DECLARE_OPTIONAL_PROPERTY(window_duration, double,
+            "Solve the problem in time windows of roughly this duration "
+            "(seconds) instead of as a single problem "
+            "(default: not windowed).");
+
+    OpenSim_DECLARE_PROPERTY(window_overlap, double,
+            "When solving in time windows, the duration (seconds) by which "
+            "each window extends into its neighbors. This portion is "
+            "discarded when stitching the windows together (default: 0.1).");
+
+    OpenSim_DECLARE_PROPERTY(window_boundary_passes, int,
+            "When solving in time windows, the number of times to re-solve "
+            "the windows with their initial muscle states set to the "
+            "preceding window's solution. 0: the windows are independent "
+            "(default: 1).");
+
+    OpenSim_DECLARE_PROPERTY(num_parallel_windows, int,
+            "When solving in time windows, the number of windows to solve at "
+            "the same time. 0: one per hardware thread (default).");
+
     MocoInverse() { constructProperties(); }
 
     void setKinematics(TableProcessor kinematics) {
@@ -207,6 +268,8 @@ public:
 private:
     void constructProperties();
     std::pair<MocoStudy, TimeSeriesTable> initializeInternal() const;
+    MocoSolution solveWindows(const MocoStudy& study,
+            TimeSeriesTable& boundaryResiduals) const;
 };
 
 } // namespace OpenSim
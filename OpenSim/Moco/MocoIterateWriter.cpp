@@ -0,0 +1,99 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: MocoIterateWriter.cpp                                             *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2024 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoIterateWriter.h"
+
+#include <OpenSim/Common/Exception.h>
+#include <OpenSim/Common/Logger.h>
+
+using namespace OpenSim;
+
+MocoIterateWriter::MocoIterateWriter(bool binary, int capacity)
+        : m_binary(binary), m_capacity(capacity) {
+    OPENSIM_THROW_IF(capacity < 1, Exception,
+            "Expected capacity to be at least 1, but received {}.", capacity);
+    m_thread = std::thread([this] { run(); });
+}
+
+MocoIterateWriter::~MocoIterateWriter() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_jobAvailable.notify_one();
+    m_thread.join();
+}
+
+void MocoIterateWriter::write(MocoTrajectory trajectory, std::string filepath) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if ((int)m_queue.size() == m_capacity) {
+            m_queue.pop_front();
+            ++m_numSkipped;
+        }
+        m_queue.push_back({std::move(trajectory), std::move(filepath)});
+    }
+    m_jobAvailable.notify_one();
+}
+
+void MocoIterateWriter::flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this] { return m_queue.empty() && !m_writing; });
+}
+
+int MocoIterateWriter::getNumWritten() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numWritten;
+}
+
+int MocoIterateWriter::getNumSkipped() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numSkipped;
+}
+
+void MocoIterateWriter::run() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobAvailable.wait(
+                    lock, [this] { return m_stopping || !m_queue.empty(); });
+            // Write everything that was queued before stopping.
+            if (m_queue.empty()) return;
+            job = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_writing = true;
+        }
+        bool written = false;
+        try {
+            if (m_binary) {
+                job.trajectory.writeBinary(job.filepath);
+            } else {
+                job.trajectory.write(job.filepath);
+            }
+            written = true;
+        } catch (const std::exception& ex) {
+            log_warn("Could not write intermediate trajectory '{}': {}",
+                    job.filepath, ex.what());
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_writing = false;
+            if (written) ++m_numWritten;
+            if (m_queue.empty()) m_idle.notify_all();
+        }
+    }
+}
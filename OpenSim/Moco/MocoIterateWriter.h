@@ -0,0 +1,85 @@
+#ifndef OPENSIM_MOCOITERATEWRITER_H
+#define OPENSIM_MOCOITERATEWRITER_H
+/* -------------------------------------------------------------------------- *
+ * OpenSim: MocoIterateWriter.h                                               *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2024 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoTrajectory.h"
+#include "osimMocoDLL.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace OpenSim {
+
+/// Writes trajectories to files on a background thread, so that a solver can
+/// save intermediate iterates without waiting for the disk. At most
+/// `capacity` trajectories wait in the queue; if the solver produces iterates
+/// faster than they can be written, the oldest waiting trajectory is skipped
+/// (it is stale anyway), so the most recent iterate is always written.
+///
+/// Errors while writing are logged as warnings; they do not interrupt the
+/// solver. The destructor writes any trajectories still in the queue.
+class OSIMMOCO_API MocoIterateWriter {
+public:
+    /// If `binary` is true, files are written with
+    /// MocoTrajectory::writeBinary(); otherwise, with MocoTrajectory::write().
+    explicit MocoIterateWriter(bool binary = false, int capacity = 2);
+    ~MocoIterateWriter();
+
+    MocoIterateWriter(const MocoIterateWriter&) = delete;
+    MocoIterateWriter& operator=(const MocoIterateWriter&) = delete;
+
+    /// Queue the trajectory to be written to `filepath`. This returns
+    /// immediately.
+    void write(MocoTrajectory trajectory, std::string filepath);
+
+    /// Wait until all queued trajectories have been written.
+    void flush();
+
+    bool isBinary() const { return m_binary; }
+    /// The number of trajectories written so far.
+    int getNumWritten() const;
+    /// The number of trajectories that were skipped because the queue was
+    /// full.
+    int getNumSkipped() const;
+
+private:
+    struct Job {
+        MocoTrajectory trajectory;
+        std::string filepath;
+    };
+    void run();
+
+    const bool m_binary;
+    const int m_capacity;
+    std::deque<Job> m_queue;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_jobAvailable;
+    std::condition_variable m_idle;
+    bool m_writing = false;
+    bool m_stopping = false;
+    int m_numWritten = 0;
+    int m_numSkipped = 0;
+    // Declared last so that the thread starts after the other members are
+    // initialized.
+    std::thread m_thread;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MOCOITERATEWRITER_H
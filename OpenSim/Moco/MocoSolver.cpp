@@ -107,6 +107,11 @@ void MocoSolver::setSolutionStats(MocoSolution& sol, bool success,
     sol.setObjectiveBreakdown(std::move(objectiveBreakdown));
 }
 
+void MocoSolver::setSolutionProfile(MocoSolution& sol,
+        TimeSeriesTable iterationProfile, TimeSeriesTable profile) {
+    sol.setSolverProfile(std::move(iterationProfile), std::move(profile));
+}
+
 std::unique_ptr<ThreadsafeJar<const MocoProblemRep>>
         MocoSolver::createProblemRepJar(int size) const {
     auto jar = OpenSim::make_unique<ThreadsafeJar<const MocoProblemRep>>();
@@ -88,6 +88,10 @@ protected:
             double duration,
             std::vector<std::pair<std::string, double>> objectiveBreakdown =
                     {});
+    /// Attach the tables described in MocoSolution::getSolverProfile() and
+    /// MocoSolution::getSolverIterationProfile().
+    static void setSolutionProfile(MocoSolution&,
+            TimeSeriesTable iterationProfile, TimeSeriesTable profile);
 
     const MocoProblemRep& getProblemRep() const {
         return m_problemRep;
@@ -24,6 +24,7 @@
 #include <regex>
 
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/MemoryInstrumentation.h>
 #include <OpenSim/Common/Reporter.h>
 #include <OpenSim/Simulation/StatesTrajectory.h>
 #include <OpenSim/Simulation/VisualizerUtilities.h>
@@ -79,6 +80,7 @@ MocoCasADiSolver& MocoStudy::initCasADiSolver() {
 MocoSolver& MocoStudy::updSolver() { return updSolver<MocoSolver>(); }
 
 MocoSolution MocoStudy::solve() const {
+    MemoryScope memoryScope("MocoStudy");
     initSolverInternal();
 
     MocoSolution solution = get_solver().solve();
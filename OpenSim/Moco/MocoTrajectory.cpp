@@ -25,8 +25,85 @@
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Simulation/Model/Model.h>
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
 using namespace OpenSim;
 
+namespace {
+// Files written by MocoTrajectory::writeBinary() start with these bytes.
+const char binaryTrajectoryTag[8] = {'M', 'O', 'C', 'O', 'T', 'R', 'J', '1'};
+
+template <typename T>
+void writeBinaryValue(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+template <typename T>
+T readBinaryValue(std::istream& stream) {
+    T value;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+void writeBinaryString(std::ostream& stream, const std::string& value) {
+    writeBinaryValue<std::uint64_t>(stream, value.size());
+    stream.write(value.data(), value.size());
+}
+std::string readBinaryString(std::istream& stream) {
+    std::string value(readBinaryValue<std::uint64_t>(stream), '\0');
+    stream.read(&value[0], value.size());
+    return value;
+}
+
+bool isBinaryTrajectoryFile(const std::string& filepath) {
+    std::ifstream stream(filepath, std::ios::binary);
+    char tag[sizeof(binaryTrajectoryTag)];
+    return stream.read(tag, sizeof(tag)) &&
+           std::memcmp(tag, binaryTrajectoryTag, sizeof(tag)) == 0;
+}
+
+TimeSeriesTable readBinaryTrajectoryFile(const std::string& filepath) {
+    std::ifstream stream(filepath, std::ios::binary);
+    stream.ignore(sizeof(binaryTrajectoryTag));
+    std::vector<std::pair<std::string, std::string>> metadata(
+            readBinaryValue<std::uint64_t>(stream));
+    for (auto& entry : metadata) {
+        entry.first = readBinaryString(stream);
+        entry.second = readBinaryString(stream);
+    }
+    const auto numRows = (int)readBinaryValue<std::uint64_t>(stream);
+    std::vector<std::string> labels(readBinaryValue<std::uint64_t>(stream));
+    for (auto& label : labels) label = readBinaryString(stream);
+    std::vector<double> time(numRows);
+    stream.read(reinterpret_cast<char*>(time.data()),
+            numRows * sizeof(double));
+    SimTK::Matrix data(numRows, (int)labels.size());
+    for (int irow = 0; irow < numRows; ++irow) {
+        for (int icol = 0; icol < (int)labels.size(); ++icol) {
+            data(irow, icol) = readBinaryValue<double>(stream);
+        }
+    }
+    OPENSIM_THROW_IF(!stream, Exception,
+            "File '{}' ended before the end of the trajectory.", filepath);
+
+    TimeSeriesTable table;
+    try {
+        table = TimeSeriesTable(time, data, labels);
+    } catch (const TimestampGreaterThanEqualToNext&) {
+        // Trajectories may have non-increasing times; see convertToTable().
+        std::vector<double> tempTime(time.size());
+        for (int i = 0; i < (int)tempTime.size(); ++i)
+            tempTime[i] = -1000.0 + i;
+        table = TimeSeriesTable(tempTime, data, labels);
+        const_cast<std::vector<double>&>(table.getIndependentColumn()) = time;
+    }
+    for (const auto& entry : metadata) {
+        table.updTableMetaData().setValueForKey(entry.first, entry.second);
+    }
+    return table;
+}
+} // anonymous namespace
+
 const std::vector<std::string> MocoTrajectory::m_allowedKeys =
         {"states", "controls", "input_controls", "multipliers", "derivatives"};
 
@@ -935,7 +1012,9 @@ void MocoTrajectory::resample(SimTK::Vector time) {
 }
 
 MocoTrajectory::MocoTrajectory(const std::string& filepath) {
-    TimeSeriesTable table(filepath);
+    const TimeSeriesTable table = isBinaryTrajectoryFile(filepath)
+                                          ? readBinaryTrajectoryFile(filepath)
+                                          : TimeSeriesTable(filepath);
     const auto& metadata = table.getTableMetaData();
     // TODO: bug with file adapters.
     // auto numStates = metadata.getValueForKey("num_states").getValue<int>();
@@ -1080,6 +1159,37 @@ void MocoTrajectory::write(const std::string& filepath) const {
     STOFileAdapter::write(convertToTable(), filepath);
 }
 
+void MocoTrajectory::writeBinary(const std::string& filepath) const {
+    const TimeSeriesTable table = convertToTable();
+    std::ofstream stream(filepath, std::ios::binary);
+    OPENSIM_THROW_IF(!stream, Exception,
+            "Could not open file '{}' for writing.", filepath);
+    stream.write(binaryTrajectoryTag, sizeof(binaryTrajectoryTag));
+    const auto& metadata = table.getTableMetaData();
+    const auto keys = metadata.getKeys();
+    writeBinaryValue<std::uint64_t>(stream, keys.size());
+    for (const auto& key : keys) {
+        writeBinaryString(stream, key);
+        writeBinaryString(stream,
+                metadata.getValueForKey(key).getValue<std::string>());
+    }
+    writeBinaryValue<std::uint64_t>(stream, table.getNumRows());
+    const auto& labels = table.getColumnLabels();
+    writeBinaryValue<std::uint64_t>(stream, labels.size());
+    for (const auto& label : labels) writeBinaryString(stream, label);
+    const auto& time = table.getIndependentColumn();
+    stream.write(reinterpret_cast<const char*>(time.data()),
+            time.size() * sizeof(double));
+    const auto& data = table.getMatrix();
+    for (int irow = 0; irow < data.nrow(); ++irow) {
+        for (int icol = 0; icol < data.ncol(); ++icol) {
+            writeBinaryValue<double>(stream, data(irow, icol));
+        }
+    }
+    OPENSIM_THROW_IF(!stream, Exception,
+            "Could not write the trajectory to file '{}'.", filepath);
+}
+
 TimeSeriesTable MocoTrajectory::convertToTable() const {
     ensureUnsealed();
     std::vector<double> time(&m_time[0], &m_time[0] + m_time.size());
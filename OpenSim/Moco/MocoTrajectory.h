@@ -185,7 +185,8 @@ public:
             const NamesAndData<SimTK::RowVector>& parameters = {});
 #endif
     /// Read a MocoTrajectory from an STO file (see STOFileAdapter). See output
-    /// of write() for the correct format.
+    /// of write() for the correct format. Files written by writeBinary() are
+    /// also accepted.
     explicit MocoTrajectory(const std::string& filepath);
 
     virtual ~MocoTrajectory() = default;
@@ -834,6 +835,12 @@ public:
     /// Save the trajectory to a STO file. Use the ."sto" file extension.
     void write(const std::string& filepath) const;
 
+    /// Save the trajectory to a compact binary file that holds the same
+    /// information as write() but is much faster to write and read. The
+    /// numbers are stored in this machine's byte order. Read the file with
+    /// MocoTrajectory's file constructor.
+    void writeBinary(const std::string& filepath) const;
+
     /// This table can be saved as a Storage file that can be used in the
     /// OpenSim GUI to visualize a motion, or as input to OpenSim's conventional
     /// tools (e.g., AnalyzeTool).
@@ -1148,6 +1155,51 @@ public:
     void printObjectiveBreakdown() const;
     /// @}
 
+    /// @name Solver profile
+    /// Some solvers (currently, only MocoCasADiSolver) record where the time
+    /// in solve() was spent, to help you decide which settings to change to
+    /// speed up a problem. If the solver did not record a profile, these
+    /// tables are empty. Write a table to a file with STOFileAdapter::write().
+    /// @{
+
+    /// Get a table with one row per solver iteration. The independent column
+    /// is the iteration number (row 0 covers the work done before the first
+    /// iteration). The columns are:
+    ///   - `wall_time`: clock time spent in the iteration (seconds).
+    ///   - `<function>_evals` and `<function>_time`: the number of times
+    ///     each type of OpenSim function was evaluated during the iteration,
+    ///     and the time spent in those evaluations (seconds, summed over all
+    ///     threads). The function types are `multibody_system`,
+    ///     `velocity_correction`, `state_projection`, `path_constraint`,
+    ///     `goal_integrand`, and `goal_endpoint`. Evaluations made to
+    ///     compute finite-difference derivatives are included.
+    ///   - The optimizer's own per-iteration measures, if it provides them
+    ///     (e.g., `obj`, `inf_pr`, `inf_du`, and `mu` for IPOPT).
+    const TimeSeriesTable& getSolverIterationProfile() const {
+        return m_solverIterationProfile;
+    }
+    /// Get a table with a single row summarizing the entire solve. The
+    /// columns are:
+    ///   - `<function>_evals`, `<function>_wall_time`, and
+    ///     `<function>_proc_time`, for each function the optimizer calls
+    ///     (e.g., `nlp_f`, `nlp_g`, `nlp_grad_f`, `nlp_jac_g`, `nlp_hess_l`)
+    ///     and for the `total`.
+    ///   - `optimizer_wall_time`: total clock time minus the time in the
+    ///     functions above; that is, time spent in the optimizer itself
+    ///     (linear solver, Hessian approximation, etc.).
+    ///   - `<function>_evals` and `<function>_time` for the OpenSim function
+    ///     types listed in getSolverIterationProfile().
+    ///   - `num_threads`: the number of threads used to evaluate the OpenSim
+    ///     functions (see MocoCasADiSolver's `parallel` property).
+    ///   - `thread_utilization`: the time spent evaluating OpenSim
+    ///     functions divided by the thread time available while the
+    ///     optimizer was evaluating its functions (between 0 and 1). Values
+    ///     well below 1 suggest that more threads will not help.
+    const TimeSeriesTable& getSolverProfile() const {
+        return m_solverProfile;
+    }
+    /// @}
+
     /// @name Access control
     /// @{
 
@@ -1189,6 +1241,11 @@ private:
         m_numIterations = numIterations;
     };
     void setSolverDuration(double duration) { m_solverDuration = duration; }
+    void setSolverProfile(TimeSeriesTable iterationProfile,
+            TimeSeriesTable profile) {
+        m_solverIterationProfile = std::move(iterationProfile);
+        m_solverProfile = std::move(profile);
+    }
     void convertToTableImpl(TimeSeriesTable&) const override;
     bool m_success = true;
     double m_objective = -1;
@@ -1196,8 +1253,12 @@ private:
     std::string m_status;
     int m_numIterations = -1;
     double m_solverDuration = -1;
+    TimeSeriesTable m_solverIterationProfile;
+    TimeSeriesTable m_solverProfile;
     // Allow solvers to set success, status, and construct a solution.
     friend class MocoSolver;
+    // MocoInverse stitches solutions from time windows.
+    friend class MocoInverse;
 };
 
 } // namespace OpenSim
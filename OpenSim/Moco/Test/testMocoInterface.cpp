@@ -1650,6 +1650,44 @@ TEST_CASE("MocoTrajectory randomize") {
     }
 }
 
+TEST_CASE("MocoTrajectory writeBinary") {
+    SimTK::Vector time(3);
+    time[0] = 0;
+    time[1] = 0.1;
+    time[2] = 0.25;
+    MocoTrajectory orig(time, {"a", "b"}, {"g", "h", "i", "j"}, {"m"},
+            {"o", "p"}, SimTK::Test::randMatrix(3, 2),
+            SimTK::Test::randMatrix(3, 4), SimTK::Test::randMatrix(3, 1),
+            SimTK::Test::randVector(2).transpose());
+    SECTION("Round trip") {
+        const std::string fname = "testMocoInterface_writeBinary.bin";
+        orig.writeBinary(fname);
+        MocoTrajectory deserialized(fname);
+        CHECK(deserialized.isNumericallyEqual(orig));
+        CHECK(deserialized.getStateNames() == orig.getStateNames());
+        CHECK(deserialized.getParameterNames() == orig.getParameterNames());
+    }
+    SECTION("MocoIterateWriter") {
+        std::vector<std::string> fnames;
+        for (int i = 0; i < 3; ++i) {
+            fnames.push_back(fmt::format(
+                    "testMocoInterface_MocoIterateWriter{}.sto", i));
+            std::remove(fnames.back().c_str());
+        }
+        {
+            // With capacity 1, a queued iterate can be replaced by a newer
+            // one, but the newest iterate is always written.
+            MocoIterateWriter writer(false, 1);
+            for (const auto& fname : fnames) writer.write(orig, fname);
+            writer.flush();
+            CHECK(writer.getNumWritten() + writer.getNumSkipped() == 3);
+            CHECK(writer.getNumWritten() >= 1);
+        }
+        MocoTrajectory deserialized(fnames.back());
+        CHECK(deserialized.isNumericallyEqual(orig));
+    }
+}
+
 TEST_CASE("createPeriodicTrajectory") {
     const std::string hip_r = "hip_r/hip_flexion_r/value";
     const std::string hip_l = "hip_l/hip_flexion_l/value";
@@ -2122,6 +2160,36 @@ TEST_CASE("Objective breakdown", "[casadi]") {
     CHECK(solution.getObjectiveTerm("goal_b") == Approx(0.01 * 7.3));
 }
 
+TEST_CASE("Solver profile", "[casadi]") {
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    auto& solver = study.updSolver<MocoCasADiSolver>();
+    solver.set_parallel(2);
+    MocoSolution solution = study.solve();
+
+    // One row per iteration, plus a row for the work before the first
+    // iteration.
+    const auto& iterations = solution.getSolverIterationProfile();
+    CHECK((int)iterations.getNumRows() == solution.getNumIterations() + 1);
+    const auto& multibodyEvals =
+            iterations.getDependentColumn("multibody_system_evals");
+    CHECK(multibodyEvals.sum() > 0);
+    CHECK(iterations.getDependentColumn("wall_time").sum() <=
+            solution.getSolverDuration());
+    CHECK(iterations.hasColumn("inf_pr"));
+
+    const auto& profile = solution.getSolverProfile();
+    REQUIRE(profile.getNumRows() == 1);
+    CHECK(profile.getDependentColumn("multibody_system_evals")[0] ==
+            multibodyEvals.sum());
+    CHECK(profile.getDependentColumn("num_threads")[0] == 2);
+    CHECK(profile.hasColumn("nlp_f_evals"));
+    CHECK(profile.getDependentColumn("optimizer_wall_time")[0] >= 0);
+    const double utilization =
+            profile.getDependentColumn("thread_utilization")[0];
+    CHECK(utilization > 0);
+    CHECK(utilization <= 1);
+}
+
 TEST_CASE("generateSpeedsFromValues() does not overwrite auxiliary states.") {
     int N = 20;
     SimTK::Vector time = createVectorLinspace(20, 0.0, 1.0);
@@ -181,6 +181,32 @@ TEST_CASE("MocoInverse Rajagopal2016, 18 muscles", "[casadi]") {
         }
     }
 
+    SECTION("Time windows") {
+        inverse.set_window_duration(0.275);
+        inverse.set_window_overlap(0.1);
+        inverse.set_num_parallel_windows(2);
+        MocoInverseSolution inverseSolution = inverse.solve();
+        MocoSolution solution = inverseSolution.getMocoSolution();
+        CHECK(solution.success());
+        CHECK(solution.getInitialTime() == Approx(0.450));
+        CHECK(solution.getFinalTime() == Approx(1.0));
+
+        // The stitched solution is close to the single-problem solution.
+        MocoTrajectory std("std_testMocoInverse_subject_18musc_solution.sto");
+        CHECK(std.compareContinuousVariablesRMS(solution,
+                                                {{"controls", {}}}) < 5e-2);
+        CHECK(std.compareContinuousVariablesRMS(solution,
+                                                {{"states", {}}}) < 5e-2);
+
+        // One boundary between the two windows.
+        const auto& residuals = inverseSolution.getWindowBoundaryResiduals();
+        REQUIRE(residuals.getNumRows() == 1);
+        CHECK(residuals.getIndependentColumn()[0] == Approx(0.725));
+        CHECK(residuals.getMatrix().normRMS() < 5e-2);
+        CHECK(inverseSolution.getOutputs().getNumRows() ==
+                (size_t)solution.getNumTimes());
+    }
+
     SECTION("With a MocoControlBoundConstraint") {
         MocoStudy study = inverse.initialize();
         auto& problem = study.updProblem();
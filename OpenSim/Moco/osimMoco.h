@@ -52,6 +52,7 @@
 #include "MocoGoal/MocoTranslationTrackingGoal.h"
 #include "MocoGoal/MocoGeneralizedForceTrackingGoal.h"
 #include "MocoInverse.h"
+#include "MocoIterateWriter.h"
 #include "MocoParameter.h"
 #include "MocoProblem.h"
 #include "MocoSolver.h"
@@ -84,12 +84,17 @@ public:
         Note, setting the accuracy will invalidate the AssemblySolver and one
         must call assemble() before being able to track().*/
     void setAccuracy(double accuracy);
+    /** Get the unitless accuracy of the assembly solution. */
+    double getAccuracy() const { return _accuracy; }
 
     /** %Set the relative weighting for constraints. Use Infinity to identify the 
         strict enforcement of constraints, otherwise any positive weighting will
         append the constraint errors to the assembly cost which the solver will
         minimize.*/
     void setConstraintWeight(double weight) {_constraintWeight = weight; }
+    /** Get the relative weighting for constraints; Infinity means that the
+        constraints are strictly enforced. */
+    double getConstraintWeight() const { return _constraintWeight; }
     
     /** Specify which coordinates to match, each with a desired value and a
         relative weighting. */
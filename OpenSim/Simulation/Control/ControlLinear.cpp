@@ -28,6 +28,12 @@
 #include <OpenSim/Common/PropertySet.h>
 #include "ControlLinear.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
 using namespace OpenSim;
 using namespace std;
 
@@ -104,6 +110,102 @@ setupProperties()
     _propKv.setValue(20);
     _propertySet.append( &_propKv );
 }
+
+namespace {
+// Parse text that holds a single number. Returns false otherwise.
+bool parseDouble(const std::string& text, double& value)
+{
+    const char* begin = text.c_str();
+    char* end = nullptr;
+    value = std::strtod(begin, &end);
+    if (end == begin) return false;
+    while (*end && std::isspace(static_cast<unsigned char>(*end))) ++end;
+    return *end == '\0';
+}
+
+// Parse a list of plain ControlLinearNode elements into (t, value) pairs.
+// Returns false if the list holds anything the generic deserializer would
+// treat differently (other elements, attributes, or unexpected children).
+bool parseNodeList(SimTK::Xml::Element& list,
+        std::vector<std::pair<double, double>>& nodes)
+{
+    nodes.clear();
+    if (list.attribute_begin() != list.attribute_end()) return false;
+    for (auto it = list.element_begin(); it != list.element_end(); ++it) {
+        if (it->getElementTag() != "ControlLinearNode") return false;
+        if (it->attribute_begin() != it->attribute_end()) return false;
+        // Missing elements keep the ControlLinearNode defaults.
+        double t = 0.0;
+        double value = 0.0;
+        for (auto child = it->element_begin(); child != it->element_end();
+                ++child) {
+            const std::string& tag = child->getElementTag();
+            double* target =
+                    tag == "t" ? &t : (tag == "value" ? &value : nullptr);
+            if (!target || !parseDouble(child->getValue(), *target)) {
+                return false;
+            }
+        }
+        nodes.emplace_back(t, value);
+    }
+    return true;
+}
+}
+
+void ControlLinear::
+updateFromXMLNode(SimTK::Xml::Element& node, int versionNumber)
+{
+    const char* names[3] = {"x_nodes", "min_nodes", "max_nodes"};
+    PropertyObjArray<ControlLinearNode>* properties[3] =
+            {&_propXNodes, &_propMinNodes, &_propMaxNodes};
+    ArrayPtrs<ControlLinearNode>* arrays[3] =
+            {&_xNodes, &_minNodes, &_maxNodes};
+
+    // Detach the lists that can be parsed directly so that the generic
+    // deserializer only handles the remaining properties. Remember where each
+    // list was among the child elements so the document can be restored.
+    std::vector<std::pair<double, double>> parsed[3];
+    SimTK::Xml::Node detached[3];
+    int position[3] = {-1, -1, -1};
+    for (int k = 0; k < 3; ++k) {
+        SimTK::Xml::element_iterator iter = node.element_begin(names[k]);
+        if (iter == node.element_end()) continue;
+        if (!parseNodeList(*iter, parsed[k])) continue;
+        position[k] = 0;
+        for (auto it = node.element_begin(); it != iter; ++it) ++position[k];
+    }
+    for (int k = 0; k < 3; ++k) {
+        if (position[k] < 0) continue;
+        detached[k] = node.removeNode(node.element_begin(names[k]));
+    }
+
+    Super::updateFromXMLNode(node, versionNumber);
+
+    for (int k = 0; k < 3; ++k) {
+        if (position[k] < 0) continue;
+        ArrayPtrs<ControlLinearNode>& nodes = *arrays[k];
+        nodes.clearAndDestroy();
+        nodes.ensureCapacity((int)parsed[k].size());
+        for (const auto& tv : parsed[k]) {
+            nodes.append(new ControlLinearNode(tv.first, tv.second));
+        }
+        properties[k]->setValueIsDefault(false);
+    }
+
+    // Restore the document. Reinserting the lists in increasing order of
+    // their original positions puts each one back where it was.
+    int order[3] = {0, 1, 2};
+    std::sort(order, order + 3,
+            [&](int a, int b) { return position[a] < position[b]; });
+    for (int k : order) {
+        if (position[k] < 0) continue;
+        SimTK::Xml::element_iterator iter = node.element_begin();
+        for (int i = 0; i < position[k] && iter != node.element_end(); ++i) {
+            ++iter;
+        }
+        node.insertNodeBefore(iter, detached[k]);
+    }
+}
 //_____________________________________________________________________________
 void ControlLinear::
 copyData(const ControlLinear &aControl)
@@ -108,6 +108,16 @@ protected:
      * Connect properties to local pointers.
      */
     void setupProperties() override;
+
+    /**
+     * Read the x_nodes, min_nodes, and max_nodes lists directly from the XML
+     * rather than deserializing each ControlLinearNode as a generic Object,
+     * which dominates the time to load large controls files. Lists that
+     * contain anything other than plain ControlLinearNode elements with `t`
+     * and `value` are read by the generic deserializer.
+     */
+    void updateFromXMLNode(SimTK::Xml::Element& node,
+                           int versionNumber) override;
     
 private:
     /**
@@ -311,6 +321,17 @@ public:
     ArrayPtrs<ControlLinearNode>& getControlMaxValues() {
         return (_maxNodes);
     }
+#ifndef SWIG
+    const ArrayPtrs<ControlLinearNode>& getControlValues() const {
+        return (_xNodes);
+    }
+    const ArrayPtrs<ControlLinearNode>& getControlMinValues() const {
+        return (_minNodes);
+    }
+    const ArrayPtrs<ControlLinearNode>& getControlMaxValues() const {
+        return (_maxNodes);
+    }
+#endif
     // Insert methods that allocate and insert a copy.
     /// Called from GUI to work around early garbage collection.
     void insertNewValueNode(int index, const ControlLinearNode& newNode) {
@@ -31,9 +31,13 @@
 //=============================================================================
 #include "ControlSet.h"
 #include "ControlLinear.h"
+#include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/Storage.h>
 #include <OpenSim/Common/XMLDocument.h>
 
+#include <algorithm>
+#include <unordered_map>
+
 
 using namespace OpenSim;
 using namespace std;
@@ -129,6 +133,90 @@ ControlSet::ControlSet(const Storage& aStorage, int numControls, int startIndex)
 //=============================================================================
 // CONSTRUCTION
 //=============================================================================
+//_____________________________________________________________________________
+/**
+ * Construct a control set from a table written by exportToTable().
+ */
+ControlSet::ControlSet(const TimeSeriesTable& table)
+{
+    setNull();
+    const auto& metadata = table.getTableMetaData();
+    if (metadata.hasKey("control_set")) {
+        setName(metadata.getValueForKey("control_set")
+                        .getValue<std::string>());
+    }
+    auto getSetting = [&](const std::string& name, const std::string& key,
+                              std::string& value) {
+        const std::string fullKey = name + "|" + key;
+        if (!metadata.hasKey(fullKey)) return false;
+        value = metadata.getValueForKey(fullKey).getValue<std::string>();
+        return true;
+    };
+    auto toBool = [](const std::string& value) {
+        return IO::Lowercase(value) == "true";
+    };
+
+    const std::vector<double>& times = table.getIndependentColumn();
+    const auto& labels = table.getColumnLabels();
+    std::unordered_map<std::string, ControlLinear*> controls;
+
+    // Value nodes and settings.
+    for (int icol = 0; icol < (int)labels.size(); ++icol) {
+        const std::string& name = labels[icol];
+        if (name.find('|') != std::string::npos) continue;
+        auto* control = new ControlLinear();
+        control->setName(name);
+        control->clearControlNodes();
+        std::string value;
+        if (getSetting(name, "is_model_control", value))
+            control->setIsModelControl(toBool(value));
+        if (getSetting(name, "extrapolate", value))
+            control->setExtrapolate(toBool(value));
+        if (getSetting(name, "filter_on", value))
+            control->setFilterOn(toBool(value));
+        if (getSetting(name, "use_steps", value))
+            control->setUseSteps(toBool(value));
+        if (getSetting(name, "default_min", value))
+            control->setDefaultParameterMin(std::stod(value));
+        if (getSetting(name, "default_max", value))
+            control->setDefaultParameterMax(std::stod(value));
+        if (getSetting(name, "kp", value)) control->setKp(std::stod(value));
+        if (getSetting(name, "kv", value)) control->setKv(std::stod(value));
+
+        // The rows are sorted by time, so the nodes can be appended directly.
+        const auto column = table.getDependentColumnAtIndex(icol);
+        auto& nodes = control->getControlValues();
+        for (int irow = 0; irow < (int)times.size(); ++irow) {
+            if (SimTK::isNaN(column[irow])) continue;
+            nodes.append(new ControlLinearNode(times[irow], column[irow]));
+        }
+        controls[name] = control;
+        adoptAndAppend(control);
+    }
+
+    // Minimum and maximum nodes.
+    for (int icol = 0; icol < (int)labels.size(); ++icol) {
+        const std::string& label = labels[icol];
+        const auto sep = label.rfind('|');
+        if (sep == std::string::npos) continue;
+        const std::string name = label.substr(0, sep);
+        const std::string suffix = label.substr(sep + 1);
+        OPENSIM_THROW_IF(suffix != "min" && suffix != "max", Exception,
+                "Expected column '{}' to end with '|min' or '|max'.", label);
+        const auto it = controls.find(name);
+        OPENSIM_THROW_IF(it == controls.end(), Exception,
+                "Expected a column '{}' for the column '{}'.", name, label);
+        auto& nodes = suffix == "min" ? it->second->getControlMinValues()
+                                      : it->second->getControlMaxValues();
+        const auto column = table.getDependentColumnAtIndex(icol);
+        for (int irow = 0; irow < (int)times.size(); ++irow) {
+            if (SimTK::isNaN(column[irow])) continue;
+            nodes.append(new ControlLinearNode(times[irow], column[irow]));
+        }
+    }
+    generateParameterMaps();
+}
+
 //_____________________________________________________________________________
 /**
  * Set the member variables to their null values.
@@ -959,6 +1047,91 @@ constructStorage(int aN,double aT1,double aT2,bool aForModelControls)
 
     return(store);
 }
+//_____________________________________________________________________________
+/**
+ * Write the controls in the compact tabular format described in the header.
+ */
+TimeSeriesTable ControlSet::
+exportToTable() const
+{
+    const int numControls = Set<Control>::getSize();
+    std::vector<const ControlLinear*> controls(numControls);
+    std::vector<double> times;
+    for (int i = 0; i < numControls; ++i) {
+        controls[i] = dynamic_cast<const ControlLinear*>(&get(i));
+        OPENSIM_THROW_IF_FRMOBJ(!controls[i], Exception,
+                "Expected only ControlLinear controls, but control '{}' is a "
+                "{}.", get(i).getName(), get(i).getConcreteClassName());
+        for (const auto* nodes : {&controls[i]->getControlValues(),
+                     &controls[i]->getControlMinValues(),
+                     &controls[i]->getControlMaxValues()}) {
+            for (int j = 0; j < nodes->getSize(); ++j) {
+                times.push_back((*nodes)[j]->getTime());
+            }
+        }
+    }
+    std::sort(times.begin(), times.end());
+    times.erase(std::unique(times.begin(), times.end()), times.end());
+
+    // One column for the value nodes of each control, and one for its min
+    // and max nodes if it has any.
+    std::vector<std::string> labels;
+    std::vector<const ArrayPtrs<ControlLinearNode>*> columns;
+    for (const auto* control : controls) {
+        labels.push_back(control->getName());
+        columns.push_back(&control->getControlValues());
+        if (control->getControlMinValues().getSize()) {
+            labels.push_back(control->getName() + "|min");
+            columns.push_back(&control->getControlMinValues());
+        }
+        if (control->getControlMaxValues().getSize()) {
+            labels.push_back(control->getName() + "|max");
+            columns.push_back(&control->getControlMaxValues());
+        }
+    }
+
+    SimTK::Matrix data((int)times.size(), (int)columns.size(), SimTK::NaN);
+    for (int icol = 0; icol < (int)columns.size(); ++icol) {
+        const ArrayPtrs<ControlLinearNode>& nodes = *columns[icol];
+        int previousRow = -1;
+        for (int j = 0; j < nodes.getSize(); ++j) {
+            const int row = (int)(std::lower_bound(times.begin(), times.end(),
+                                          nodes[j]->getTime()) -
+                                  times.begin());
+            OPENSIM_THROW_IF_FRMOBJ(row == previousRow, Exception,
+                    "Expected the nodes in '{}' to have distinct times, but "
+                    "found two nodes at time {}.",
+                    labels[icol], nodes[j]->getTime());
+            data(row, icol) = nodes[j]->getValue();
+            previousRow = row;
+        }
+    }
+
+    TimeSeriesTable table(times, data, labels);
+    table.addTableMetaData<std::string>("control_set", getName());
+    auto toString = [](bool value) { return value ? "true" : "false"; };
+    for (const auto* control : controls) {
+        const std::string& name = control->getName();
+        table.addTableMetaData<std::string>(name + "|is_model_control",
+                toString(control->getIsModelControl()));
+        table.addTableMetaData<std::string>(name + "|extrapolate",
+                toString(control->getExtrapolate()));
+        table.addTableMetaData<std::string>(name + "|filter_on",
+                toString(control->getFilterOn()));
+        table.addTableMetaData<std::string>(name + "|use_steps",
+                toString(control->getUseSteps()));
+        // Use the shortest representation that reads back exactly.
+        table.addTableMetaData<std::string>(name + "|default_min",
+                fmt::format("{}", control->getDefaultParameterMin()));
+        table.addTableMetaData<std::string>(name + "|default_max",
+                fmt::format("{}", control->getDefaultParameterMax()));
+        table.addTableMetaData<std::string>(name + "|kp",
+                fmt::format("{}", control->getKp()));
+        table.addTableMetaData<std::string>(name + "|kv",
+                fmt::format("{}", control->getKv()));
+    }
+    return table;
+}
 //-----------------------------------------------------------------------------
 // PARAMETER MAPS
 //-----------------------------------------------------------------------------
@@ -31,6 +31,7 @@
 // INCLUDES
 #include "Control.h"
 #include <OpenSim/Common/Set.h>
+#include <OpenSim/Common/TimeSeriesTable.h>
 
 
 //=============================================================================
@@ -75,6 +76,27 @@ public:
     // Constructor from a storage, useful for connecting result files to 
     // analyses that expect ControlSets. Default arguments 
     ControlSet(const Storage& aStorage, int nControlsToConvert=0, int aStartIndex=0);
+
+    /** Construct a set of ControlLinear%s from a table in the compact format
+    written by exportToTable(). Each column without a `|min` or `|max` suffix
+    is a control, whose nodes are the rows at which the column is not NaN.
+    Settings missing from the table's metadata keep their default values, so
+    any table of controls versus time (e.g., a _controls.sto file) can be
+    loaded. */
+    explicit ControlSet(const TimeSeriesTable& table);
+
+    /** Write this set in a compact tabular format that is much faster to
+    write and read than the XML format: one row for each distinct node time,
+    one column `<name>` with the value nodes of each control, and columns
+    `<name>|min` and `<name>|max` for controls with minimum or maximum nodes.
+    A column is NaN at the times at which its control has no node. The
+    settings of each control (e.g., `<name>|use_steps`, `<name>|default_min`)
+    are stored in the table metadata, along with the key `control_set`, which
+    holds the name of the set. Constructing a ControlSet from the table
+    recovers this set exactly.
+    @throws Exception if the set contains a control that is not a
+        ControlLinear, or a control with two nodes at the same time. */
+    TimeSeriesTable exportToTable() const;
 private:
     void setNull();
     void setupProperties();
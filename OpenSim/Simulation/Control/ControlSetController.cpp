@@ -38,6 +38,8 @@
 #include <OpenSim/Simulation/Model/Actuator.h>
 #include <OpenSim/Simulation/Model/Model.h>
 
+#include <fstream>
+
 //=============================================================================
 // STATICS
 //=============================================================================
@@ -47,6 +49,26 @@
 // "OpenSim::" prefix.
 using namespace OpenSim;
 
+namespace {
+    // Whether the header of a .sto file has the `control_set` key that
+    // ControlSet::exportToTable() writes. Only the header is read; a file that
+    // cannot be opened is left for the parser to report.
+    bool hasControlSetHeader(const std::string& fileName) {
+        std::ifstream file(fileName);
+        std::string line;
+        while (std::getline(file, line)) {
+            IO::TrimWhitespace(line);
+            if (line == "endheader") break;
+            const auto equals = line.find('=');
+            if (equals == std::string::npos) continue;
+            std::string key = line.substr(0, equals);
+            IO::TrimWhitespace(key);
+            if (key == "control_set") return true;
+        }
+        return false;
+    }
+}
+
 //=============================================================================
 // CONSTRUCTOR(S) AND DESTRUCTOR
 //=============================================================================
@@ -231,9 +253,18 @@ void ControlSetController::extendFinalizeFromProperties()
     ControlSet* loadedControlSet = nullptr;
     if (hasFile) {
         try {
-            if (_controlsFileName.rfind(".sto") != std::string::npos)
-                loadedControlSet = new ControlSet(Storage(_controlsFileName));
-            else
+            if (_controlsFileName.rfind(".sto") != std::string::npos) {
+                // Tables written by ControlSet::exportToTable() keep the
+                // settings of each control; other files are read as before.
+                // The header decides which parser reads the file, so each
+                // file is parsed once.
+                if (hasControlSetHeader(_controlsFileName))
+                    loadedControlSet = new ControlSet(
+                            TimeSeriesTable(_controlsFileName));
+                else
+                    loadedControlSet =
+                            new ControlSet(Storage(_controlsFileName));
+            } else
                 loadedControlSet = new ControlSet(_controlsFileName);
         }
         // Should only catch an "UnaccessibleFileException" since we would want
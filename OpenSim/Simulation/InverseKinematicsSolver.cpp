@@ -219,6 +219,12 @@ SimTK::Vec3 InverseKinematicsSolver::computeCurrentMarkerLocation(const std::str
 SimTK::Vec3 InverseKinematicsSolver::computeCurrentMarkerLocation(int markerIndex)
 {
     if(markerIndex >=0 && markerIndex < _markerAssemblyCondition->getNumMarkers()){
+        if (_trackedWithGaussNewton) {
+            const TrackedMarker& marker = _trackedMarkers[markerIndex];
+            return getModel().getMatterSubsystem()
+                    .getMobilizedBody(marker.body)
+                    .findStationLocationInGround(_trackedState, marker.station);
+        }
         return _markerAssemblyCondition->findCurrentMarkerLocation(SimTK::Markers::MarkerIx(markerIndex));
     }
     else
@@ -230,7 +236,7 @@ void InverseKinematicsSolver::computeCurrentMarkerLocations(SimTK::Array_<SimTK:
 {
     markerLocations.resize(_markerAssemblyCondition->getNumMarkers());
     for(unsigned int i=0; i<markerLocations.size(); i++)
-        markerLocations[i] = _markerAssemblyCondition->findCurrentMarkerLocation(SimTK::Markers::MarkerIx(i));
+        markerLocations[i] = computeCurrentMarkerLocation(int(i));
 }
 
 
@@ -246,6 +252,9 @@ double InverseKinematicsSolver::computeCurrentMarkerError(const std::string &mar
 double InverseKinematicsSolver::computeCurrentMarkerError(int markerIndex)
 {
     if(markerIndex >=0 && markerIndex < _markerAssemblyCondition->getNumMarkers()){
+        if (_trackedWithGaussNewton) {
+            return std::sqrt(computeCurrentSquaredMarkerError(markerIndex));
+        }
         return _markerAssemblyCondition->findCurrentMarkerError(SimTK::Markers::MarkerIx(markerIndex));
     }
     else
@@ -257,7 +266,7 @@ void InverseKinematicsSolver::computeCurrentMarkerErrors(SimTK::Array_<double> &
 {
     markerErrors.resize(_markerAssemblyCondition->getNumMarkers());
     for(unsigned int i=0; i<markerErrors.size(); i++)
-        markerErrors[i] = _markerAssemblyCondition->findCurrentMarkerError(SimTK::Markers::MarkerIx(i));
+        markerErrors[i] = computeCurrentMarkerError(int(i));
 }
 
 
@@ -273,6 +282,14 @@ double InverseKinematicsSolver::computeCurrentSquaredMarkerError(const std::stri
 double InverseKinematicsSolver::computeCurrentSquaredMarkerError(int markerIndex)
 {
     if(markerIndex >=0 && markerIndex < _markerAssemblyCondition->getNumMarkers()){
+        if (_trackedWithGaussNewton) {
+            // As with SimTK::Markers, missing observations have no error.
+            const Vec3& observation = _markerObservations[
+                    _trackedMarkers[markerIndex].observationIndex];
+            if (!observation.isFinite()) return 0;
+            return (computeCurrentMarkerLocation(markerIndex) - observation)
+                    .normSqr();
+        }
         return _markerAssemblyCondition->findCurrentMarkerErrorSquared(SimTK::Markers::MarkerIx(markerIndex));
     }
     else
@@ -285,8 +302,7 @@ void InverseKinematicsSolver::
 {
     markerErrors.resize(_markerAssemblyCondition->getNumMarkers());
     for(unsigned int i=0; i<markerErrors.size(); i++)
-        markerErrors[i] = _markerAssemblyCondition->
-                    findCurrentMarkerErrorSquared(SimTK::Markers::MarkerIx(i));
+        markerErrors[i] = computeCurrentSquaredMarkerError(int(i));
 }
 
 /* Marker errors are reported in order different from tasks file or model, find name corresponding to passed in index  */
@@ -308,6 +324,14 @@ SimTK::Rotation InverseKinematicsSolver::
 SimTK::Rotation InverseKinematicsSolver::computeCurrentSensorOrientation(int osensorIndex)
 {
     if (osensorIndex >= 0 && osensorIndex < _orientationAssemblyCondition->getNumOSensors()) {
+        if (_trackedWithGaussNewton) {
+            const TrackedOrientation& osensor =
+                    _trackedOrientations[osensorIndex];
+            return getModel().getMatterSubsystem()
+                           .getMobilizedBody(osensor.body)
+                           .getBodyRotation(_trackedState) *
+                   osensor.R_BF;
+        }
         return _orientationAssemblyCondition->findCurrentOSensorOrientation(SimTK::OrientationSensors::OSensorIx(osensorIndex));
     }
     else
@@ -320,8 +344,7 @@ void InverseKinematicsSolver::computeCurrentSensorOrientations(
 {
     osensorOrientations.resize(_orientationAssemblyCondition->getNumOSensors());
     for (unsigned int i = 0; i< osensorOrientations.size(); i++)
-        osensorOrientations[i] =
-            _orientationAssemblyCondition->findCurrentOSensorOrientation(SimTK::OrientationSensors::OSensorIx(i));
+        osensorOrientations[i] = computeCurrentSensorOrientation(int(i));
 }
 
 
@@ -339,6 +362,15 @@ double InverseKinematicsSolver::computeCurrentOrientationError(int osensorIndex)
 {
     if (osensorIndex >= 0 && 
         osensorIndex < _orientationAssemblyCondition->getNumOSensors()) {
+        if (_trackedWithGaussNewton) {
+            const Rotation& observation = _orientationObservations[
+                    _trackedOrientations[osensorIndex].observationIndex];
+            if (!observation.isFinite()) return 0;
+            const Rotation R_error =
+                    ~computeCurrentSensorOrientation(osensorIndex) *
+                    observation;
+            return std::abs(R_error.convertRotationToAngleAxis()[0]);
+        }
         return _orientationAssemblyCondition->
             findCurrentOSensorError(
                 SimTK::OrientationSensors::OSensorIx(osensorIndex));
@@ -355,8 +387,7 @@ void InverseKinematicsSolver::computeCurrentOrientationErrors(
 {
     osensorErrors.resize(_orientationAssemblyCondition->getNumOSensors());
     for (unsigned int i = 0; i<osensorErrors.size(); i++)
-        osensorErrors[i] = _orientationAssemblyCondition->
-        findCurrentOSensorError(OrientationSensors::OSensorIx(i));
+        osensorErrors[i] = computeCurrentOrientationError(int(i));
 }
 
 /* Orientation errors may be reported in an order that may be different from
@@ -372,6 +403,15 @@ std::string InverseKinematicsSolver::
     of the base assembly solver, that is going to do the assembly.  */
 void InverseKinematicsSolver::setupGoals(SimTK::State &s)
 {
+    // The base class unlocks coordinates in s, so note which coordinates
+    // trackGaussNewton() must hold fixed before it does.
+    const CoordinateSet& modelCoordSet = getModel().getCoordinateSet();
+    std::vector<bool> fixedCoordinates(modelCoordSet.getSize());
+    for (int i = 0; i < modelCoordSet.getSize(); ++i) {
+        fixedCoordinates[i] = modelCoordSet[i].getLocked(s) ||
+                              modelCoordSet[i].isPrescribed(s);
+    }
+
     // Setup coordinates performed by the base class
     AssemblySolver::setupGoals(s);
 
@@ -379,11 +419,14 @@ void InverseKinematicsSolver::setupGoals(SimTK::State &s)
 
     setupOrientationsGoal(s);
 
+    setupGaussNewton(s, fixedCoordinates);
+
     updateGoals(s);
 }
 
 void InverseKinematicsSolver::setupMarkersGoal(SimTK::State &s)
 {
+    _trackedMarkers.clear();
     // If we have no markers reference to track, then return.
     if (!_markersReference || _markersReference->getNumRefs() < 1) {
         return;
@@ -416,6 +459,8 @@ void InverseKinematicsSolver::setupMarkersGoal(SimTK::State &s)
             _markerAssemblyCondition->
                 addMarker(marker.getName(), mobod, X_BF*marker.get_location(),
                     markerWeights[i]);
+            _trackedMarkers.push_back({mobod.getMobilizedBodyIndex(),
+                    X_BF*marker.get_location(), int(i)});
         }
     }
 
@@ -430,6 +475,7 @@ void InverseKinematicsSolver::setupMarkersGoal(SimTK::State &s)
 
 void InverseKinematicsSolver::setupOrientationsGoal(SimTK::State &s)
 {
+    _trackedOrientations.clear();
     // If we have no orientations reference to track, then return.
     if (!_orientationsReference || _orientationsReference->getNumRefs() < 1) {
         return;
@@ -458,6 +504,8 @@ void InverseKinematicsSolver::setupOrientationsGoal(SimTK::State &s)
                 modelFrame.getMobilizedBodyIndex(),
                 modelFrame.findTransformInBaseFrame().R(),
                 orientationWeights[index]);
+            _trackedOrientations.push_back({modelFrame.getMobilizedBodyIndex(),
+                    modelFrame.findTransformInBaseFrame().R(), index});
         }
     }
 
@@ -481,12 +529,11 @@ void InverseKinematicsSolver::updateGoals(SimTK::State &s)
         double nextTime = NaN;
         if (_orientationsReference &&
                 _orientationsReference->getNumRefs() > 0) {
-            SimTK::Array_<SimTK::Rotation> orientationValues;
             nextTime = _orientationsReference->getNextValuesAndTime(
-                    orientationValues);
+                    _orientationObservations);
             s.setTime(nextTime);
             _orientationAssemblyCondition->moveAllObservations(
-                    orientationValues);
+                    _orientationObservations);
         }
         // update coordinates if any based on new time
         AssemblySolver::updateGoals(s);
@@ -498,17 +545,401 @@ void InverseKinematicsSolver::updateGoals(SimTK::State &s)
     double nextTime = s.getTime();
     // specify the marker observations to be matched
     if (_markersReference && _markersReference->getNumRefs() > 0) {
-        SimTK::Array_<SimTK::Vec3> markerValues;
-        _markersReference->getValuesAtTime(nextTime, markerValues);
-        _markerAssemblyCondition->moveAllObservations(markerValues);
+        _markersReference->getValuesAtTime(nextTime, _markerObservations);
+        _markerAssemblyCondition->moveAllObservations(_markerObservations);
     }
 
     // specify the orientation observations to be matched
     if (_orientationsReference && _orientationsReference->getNumRefs() > 0) {
-        SimTK::Array_<SimTK::Rotation> orientationValues;
-        _orientationsReference->getValuesAtTime(nextTime, orientationValues);
-        _orientationAssemblyCondition->moveAllObservations(orientationValues);
+        _orientationsReference->getValuesAtTime(
+                nextTime, _orientationObservations);
+        _orientationAssemblyCondition->moveAllObservations(
+                _orientationObservations);
+    }
+}
+
+//______________________________________________________________________________
+/*
+ * Gauss-Newton tracking
+ */
+namespace {
+    // Settings for the Levenberg-Marquardt damping of the Gauss-Newton steps.
+    constexpr int MaxGaussNewtonIterations = 100;
+    constexpr double InitialDamping = 1e-3;
+    constexpr double MinDamping = 1e-9;
+    constexpr double MaxDamping = 1e9;
+    // Lower bound on a diagonal entry of the normal equations when scaling
+    // the damping, so mobilities that no goal depends on stay put.
+    constexpr double MinDampingScale = 1e-9;
+    // Weight on constraint errors when constraints are strictly enforced.
+    // Each step is followed by a projection onto the constraint manifold;
+    // this weight keeps the steps nearly tangent to it.
+    constexpr double ConstraintPenaltyWeight = 1e6;
+
+    // The goals of one frame, without markers and orientation sensors whose
+    // observation is missing (NaN) or whose weight is zero.
+    struct TrackingGoals {
+        Array_<MobilizedBodyIndex> markerBodies;
+        Array_<Vec3> markerStations;
+        Array_<Vec3> markerObservations;
+        Array_<double> markerWeights;
+        Array_<MobilizedBodyIndex> osensorBodies;
+        Array_<Vec3> osensorOrigins;
+        Array_<Rotation> osensorR_BF;
+        Array_<Rotation> osensorObservations;
+        Array_<double> osensorWeights;
+        Array_<QIndex> coordinateQs;
+        Array_<double> coordinateValues;
+        Array_<double> coordinateWeights;
+        double constraintWeight = 0;
+    };
+
+    // Add weight*~row*row to H and weight*residual*~row to g, where row is
+    // the derivative of residual with respect to u. Only the nonzero entries
+    // of row that belong to free mobilities are visited; the Jacobian of a
+    // marker is zero for every mobility that is not between its body and
+    // Ground, so H is accumulated in much less than nu^2 work per row.
+    template <typename Row>
+    void addResidualRow(const Row& row, double residual, double weight,
+            const Array_<int>& freeIndexOfU,
+            std::vector<std::pair<int, double>>& nonzeros, Matrix& H,
+            Vector& g) {
+        nonzeros.clear();
+        for (int u = 0; u < (int)freeIndexOfU.size(); ++u) {
+            const double value = row[u];
+            if (freeIndexOfU[u] >= 0 && value != 0) {
+                nonzeros.emplace_back(freeIndexOfU[u], value);
+            }
+        }
+        for (const auto& a : nonzeros) {
+            g[a.first] += weight * a.second * residual;
+            for (const auto& b : nonzeros) {
+                H(a.first, b.first) += weight * a.second * b.second;
+            }
+        }
+    }
+
+    // Return the weighted sum of squared errors of the goals at the
+    // configuration in s, which must be realized to Position. If H and g are
+    // not null, also form the Gauss-Newton normal equations H*dx = -g over
+    // the free mobilities.
+    double calcTrackingCost(const SimbodyMatterSubsystem& matter,
+            const State& s, const TrackingGoals& goals,
+            const Array_<int>& freeIndexOfU, Matrix* H, Vector* g) {
+        const bool formNormalEquations = H && g;
+        if (formNormalEquations) {
+            *H = 0;
+            *g = 0;
+        }
+        std::vector<std::pair<int, double>> nonzeros;
+        double cost = 0;
+
+        // Markers: the residual is the marker's position error in Ground.
+        const int nm = (int)goals.markerBodies.size();
+        Matrix JS;
+        if (formNormalEquations && nm > 0) {
+            matter.calcStationJacobian(
+                    s, goals.markerBodies, goals.markerStations, JS);
+        }
+        for (int i = 0; i < nm; ++i) {
+            const Vec3 error = matter.getMobilizedBody(goals.markerBodies[i])
+                    .findStationLocationInGround(s, goals.markerStations[i]) -
+                    goals.markerObservations[i];
+            const double weight = goals.markerWeights[i];
+            cost += weight * error.normSqr();
+            if (formNormalEquations) {
+                for (int k = 0; k < 3; ++k) {
+                    addResidualRow(JS.row(3 * i + k), error[k], weight,
+                            freeIndexOfU, nonzeros, *H, *g);
+                }
+            }
+        }
+
+        // Orientation sensors: the residual is the rotation vector (in
+        // Ground) that takes the observed orientation to the model's. Its
+        // derivative is the angular part of the frame Jacobian, which is
+        // exact at the solution and approximate away from it.
+        const int no = (int)goals.osensorBodies.size();
+        Matrix JF;
+        if (formNormalEquations && no > 0) {
+            matter.calcFrameJacobian(
+                    s, goals.osensorBodies, goals.osensorOrigins, JF);
+        }
+        for (int i = 0; i < no; ++i) {
+            const Rotation R_GF =
+                    matter.getMobilizedBody(goals.osensorBodies[i])
+                            .getBodyRotation(s) *
+                    goals.osensorR_BF[i];
+            const Vec4 angleAxis =
+                    (R_GF * ~goals.osensorObservations[i])
+                            .convertRotationToAngleAxis();
+            const Vec3 error = angleAxis[0] * angleAxis.getSubVec<3>(1);
+            const double weight = goals.osensorWeights[i];
+            cost += weight * error.normSqr();
+            if (formNormalEquations) {
+                for (int k = 0; k < 3; ++k) {
+                    addResidualRow(JF.row(6 * i + k), error[k], weight,
+                            freeIndexOfU, nonzeros, *H, *g);
+                }
+            }
+        }
+
+        // Coordinates: dq/du is a row of N, which is the identity for most
+        // mobilizers.
+        Vector unitQ(s.getNQ(), 0.0), rowOfN(s.getNU());
+        for (int i = 0; i < (int)goals.coordinateQs.size(); ++i) {
+            const QIndex q = goals.coordinateQs[i];
+            const double error = s.getQ()[q] - goals.coordinateValues[i];
+            const double weight = goals.coordinateWeights[i];
+            cost += weight * error * error;
+            if (formNormalEquations) {
+                unitQ[q] = 1;
+                matter.multiplyByN(s, true, unitQ, rowOfN);
+                unitQ[q] = 0;
+                addResidualRow(rowOfN, error, weight, freeIndexOfU, nonzeros,
+                        *H, *g);
+            }
+        }
+
+        // Holonomic constraints.
+        if (goals.constraintWeight > 0 && s.getNQErr() > 0) {
+            const Vector& qErr = s.getQErr();
+            cost += goals.constraintWeight * qErr.normSqr();
+            if (formNormalEquations) {
+                Matrix P;
+                matter.calcP(s, P);
+                for (int i = 0; i < qErr.size(); ++i) {
+                    addResidualRow(P.row(i), qErr[i], goals.constraintWeight,
+                            freeIndexOfU, nonzeros, *H, *g);
+                }
+            }
+        }
+        return cost;
+    }
+}
+
+void InverseKinematicsSolver::setupGaussNewton(const SimTK::State& s,
+        const std::vector<bool>& fixedCoordinates)
+{
+    _trackedWithGaussNewton = false;
+    // Coordinates index into q and u alike only if there are no quaternions.
+    _canTrackWithGaussNewton = s.getNQ() == s.getNU();
+    _freeIndexOfU.assign(s.getNU(), 0);
+    _clampedCoordinates.clear();
+    _coordinateReferenceQs.clear();
+    if (!_canTrackWithGaussNewton) return;
+
+    const SimbodyMatterSubsystem& matter = getModel().getMatterSubsystem();
+    const CoordinateSet& modelCoordSet = getModel().getCoordinateSet();
+    for (int i = 0; i < modelCoordSet.getSize(); ++i) {
+        const Coordinate& coord = modelCoordSet[i];
+        const MobilizedBody& mobod =
+                matter.getMobilizedBody(coord.getBodyIndex());
+        const QIndex q(mobod.getFirstQIndex(s) + coord.getMobilizerQIndex());
+        const UIndex u(mobod.getFirstUIndex(s) + coord.getMobilizerQIndex());
+        if (fixedCoordinates[i]) {
+            _freeIndexOfU[u] = -1;
+        } else if (coord.getClamped(s)) {
+            _clampedCoordinates.push_back(
+                    {q, u, coord.getRangeMin(), coord.getRangeMax()});
+        }
+    }
+    _numFreeMobilities = 0;
+    for (auto& index : _freeIndexOfU) {
+        if (index >= 0) index = _numFreeMobilities++;
+    }
+
+    // References to locked coordinates were removed by the base class.
+    for (const auto& coordRef : getCoordinateReferences()) {
+        const Coordinate& coord = modelCoordSet.get(coordRef.getName());
+        _coordinateReferenceQs.push_back(QIndex(
+                matter.getMobilizedBody(coord.getBodyIndex())
+                        .getFirstQIndex(s) +
+                coord.getMobilizerQIndex()));
+    }
+}
+
+void InverseKinematicsSolver::assemble(SimTK::State& s)
+{
+    AssemblySolver::assemble(s);
+    _numAssemblyStepsAfterLastSolve = getAssembler().getNumAssemblySteps();
+}
+
+void InverseKinematicsSolver::track(SimTK::State& s)
+{
+    if (_trackingMethod == TrackingMethod::GaussNewton &&
+            _canTrackWithGaussNewton) {
+        trackGaussNewton(s);
+        return;
+    }
+    AssemblySolver::track(s);
+    // The Assembler counts steps cumulatively.
+    const int numSteps = getAssembler().getNumAssemblySteps();
+    _numIterationsInLastTrack = numSteps - _numAssemblyStepsAfterLastSolve;
+    _numAssemblyStepsAfterLastSolve = numSteps;
+    _trackedWithGaussNewton = false;
+}
+
+void InverseKinematicsSolver::trackGaussNewton(SimTK::State& s)
+{
+    if (!getAssembler().isInitialized()) {
+        throw Exception("InverseKinematicsSolver::track() failed: "
+                        "assemble() must be called first.");
+    }
+    updateGoals(s);
+
+    // Gather this frame's goals.
+    TrackingGoals goals;
+    if (_markersReference && _markersReference->getNumRefs() > 0) {
+        SimTK::Array_<double> weights;
+        _markersReference->getWeights(s, weights);
+        for (const auto& marker : _trackedMarkers) {
+            const Vec3& observation =
+                    _markerObservations[marker.observationIndex];
+            const double weight = weights[marker.observationIndex];
+            if (!observation.isFinite() || weight <= 0) continue;
+            goals.markerBodies.push_back(marker.body);
+            goals.markerStations.push_back(marker.station);
+            goals.markerObservations.push_back(observation);
+            goals.markerWeights.push_back(weight);
+        }
+    }
+    if (_orientationsReference && _orientationsReference->getNumRefs() > 0) {
+        SimTK::Array_<double> weights;
+        _orientationsReference->getWeights(s, weights);
+        for (const auto& osensor : _trackedOrientations) {
+            const Rotation& observation =
+                    _orientationObservations[osensor.observationIndex];
+            const double weight = weights[osensor.observationIndex];
+            if (!observation.isFinite() || weight <= 0) continue;
+            goals.osensorBodies.push_back(osensor.body);
+            goals.osensorOrigins.push_back(Vec3(0));
+            goals.osensorR_BF.push_back(osensor.R_BF);
+            goals.osensorObservations.push_back(observation);
+            goals.osensorWeights.push_back(weight);
+        }
+    }
+    const auto& coordinateReferences = getCoordinateReferences();
+    for (unsigned int i = 0; i < coordinateReferences.size(); ++i) {
+        goals.coordinateQs.push_back(_coordinateReferenceQs[i]);
+        goals.coordinateValues.push_back(coordinateReferences[i].getValue(s));
+        goals.coordinateWeights.push_back(
+                coordinateReferences[i].getWeight(s));
+    }
+    const bool enforceConstraints =
+            isInf(getConstraintWeight()) && s.getNQErr() > 0;
+    goals.constraintWeight = enforceConstraints ? ConstraintPenaltyWeight
+                                                : getConstraintWeight();
+
+    const SimbodyMatterSubsystem& matter = getModel().getMatterSubsystem();
+    const MultibodySystem& system = getModel().getMultibodySystem();
+    const double accuracy = getAccuracy();
+    const int nf = _numFreeMobilities;
+
+    Matrix H(nf, nf);
+    Vector g(nf);
+    Vector du(s.getNU(), 0.0), dq(s.getNQ());
+    system.realize(s, Stage::Position);
+    double cost = calcTrackingCost(matter, s, goals, _freeIndexOfU, &H, &g);
+    double damping = InitialDamping;
+    int iter = 0;
+    bool converged = nf == 0;
+    while (!converged && iter < MaxGaussNewtonIterations) {
+        ++iter;
+        const Vector q0 = s.getQ();
+        bool improved = false;
+        while (!improved && damping <= MaxDamping) {
+            Matrix A = H;
+            for (int i = 0; i < nf; ++i) {
+                A(i, i) += damping * std::max(H(i, i), MinDampingScale);
+            }
+            // Solve for the step. A clamped coordinate at a bound that the
+            // step would cross is held at the bound and the step is solved
+            // again, so the other mobilities can make up for it.
+            std::vector<bool> heldAtBound(nf, false);
+            bool resolve = true;
+            while (resolve) {
+                Matrix Ai = A;
+                Vector b = -g;
+                for (int i = 0; i < nf; ++i) {
+                    if (!heldAtBound[i]) continue;
+                    for (int j = 0; j < nf; ++j) Ai(i, j) = Ai(j, i) = 0;
+                    Ai(i, i) = 1;
+                    b[i] = 0;
+                }
+                Vector dx;
+                FactorLU lu(Ai);
+                lu.solve(b, dx);
+                for (int u = 0; u < s.getNU(); ++u) {
+                    const int f = _freeIndexOfU[u];
+                    du[u] = f >= 0 ? dx[f] : 0;
+                }
+                matter.multiplyByN(s, false, du, dq);
+
+                resolve = false;
+                for (const auto& clamped : _clampedCoordinates) {
+                    const int f = _freeIndexOfU[clamped.u];
+                    if (f < 0 || heldAtBound[f]) continue;
+                    const double q = q0[clamped.q];
+                    const double qNew = q + dq[clamped.q];
+                    if ((qNew < clamped.rangeMin &&
+                                q <= clamped.rangeMin + accuracy) ||
+                            (qNew > clamped.rangeMax &&
+                                    q >= clamped.rangeMax - accuracy)) {
+                        heldAtBound[f] = true;
+                        resolve = true;
+                    }
+                }
+            }
+
+            // Take the step, staying within coordinate ranges and (if
+            // constraints are enforced) on the constraint manifold.
+            s.updQ() = q0 + dq;
+            for (const auto& clamped : _clampedCoordinates) {
+                s.updQ()[clamped.q] = clamp(clamped.rangeMin,
+                        s.getQ()[clamped.q], clamped.rangeMax);
+            }
+            system.realize(s, Stage::Position);
+            if (enforceConstraints) {
+                system.projectQ(s, accuracy);
+                system.realize(s, Stage::Position);
+            }
+
+            const double trialCost =
+                    calcTrackingCost(matter, s, goals, _freeIndexOfU,
+                            nullptr, nullptr);
+            if (trialCost <= cost) {
+                improved = true;
+                damping = std::max(damping / 10, MinDamping);
+                converged = (s.getQ() - q0).normInf() <= accuracy;
+                cost = trialCost;
+            } else {
+                s.updQ() = q0;
+                system.realize(s, Stage::Position);
+                damping *= 10;
+            }
+        }
+        // If no damped step reduces the cost, q0 is a minimum to within
+        // the precision of the cost.
+        if (!improved) break;
+        if (!converged) {
+            cost = calcTrackingCost(matter, s, goals, _freeIndexOfU, &H, &g);
+        }
+    }
+    _numIterationsInLastTrack = iter;
+
+    log_debug("Tracking (Gauss-Newton): t= {} (iterations={} cost={})",
+            s.getTime(), iter, cost);
+
+    // Keep the solution for the computeCurrent*() methods.
+    if (!_trackedWithGaussNewton) {
+        _trackedState = s;
+        _trackedWithGaussNewton = true;
+    } else {
+        _trackedState.updTime() = s.getTime();
+        _trackedState.updQ() = s.getQ();
     }
+    system.realize(_trackedState, Stage::Position);
 }
 
 } // end of namespace OpenSim
@@ -231,6 +231,44 @@ public:
         _advanceTimeFromReference = newValue;
     };
 
+    /** The algorithms that track() can use to update the model coordinates.
+        assemble() always uses SimTK::Assembler. */
+    enum class TrackingMethod {
+        /** Use SimTK::Assembler (the default). */
+        Assembler,
+        /** Take Levenberg-Marquardt-damped Gauss-Newton steps on the weighted
+            marker, orientation, coordinate and constraint errors. The
+            Jacobian of the errors is formed from station and frame Jacobians,
+            and the normal equations are accumulated using only the mobilities
+            each error depends on. Locked and prescribed coordinates are held
+            fixed and clamped coordinates are kept within their ranges. This
+            is a local method that is usually faster than Assembler when
+            consecutive frames are close together. Models with quaternions
+            always use Assembler. */
+        GaussNewton
+    };
+    /** %Set the algorithm that track() uses to update the model coordinates.
+        Takes effect when track() is called next. */
+    void setTrackingMethod(TrackingMethod method) { _trackingMethod = method; }
+    /** Get the algorithm that track() uses to update the model coordinates. */
+    TrackingMethod getTrackingMethod() const { return _trackingMethod; }
+    /** Return the number of iterations (Gauss-Newton steps or
+        SimTK::Assembler assembly steps) taken by the last call to track(). */
+    int getNumIterationsInLastTrack() const {
+        return _numIterationsInLastTrack;
+    }
+
+    /** Assemble a model configuration that meets the InverseKinematics
+        conditions (desired values and constraints) starting from an initial
+        state that does not have to satisfy the constraints. This always uses
+        SimTK::Assembler. */
+    void assemble(SimTK::State& s) override;
+
+    /** Obtain a model configuration that meets the InverseKinematics
+        conditions at the time in s, starting from the coordinates in s, using
+        the current TrackingMethod. assemble() must be called first. */
+    void track(SimTK::State& s) override;
+
 protected:
     /** Override to include point of interest matching (Marker tracking)
         as well ad Frame orientation (OSensor) tracking.
@@ -248,6 +286,16 @@ private:
         assembly problem. */
     void setupOrientationsGoal(SimTK::State &s);
 
+    /** Record the mobilities and coordinate bounds used by
+        trackGaussNewton(). fixedCoordinates flags, for each coordinate in the
+        model's CoordinateSet, whether it was locked or prescribed before the
+        base class unlocked coordinates in s. */
+    void setupGaussNewton(const SimTK::State& s,
+            const std::vector<bool>& fixedCoordinates);
+
+    /** track() using TrackingMethod::GaussNewton. */
+    void trackGaussNewton(SimTK::State& s);
+
     // The marker reference values and weightings
     std::shared_ptr<MarkersReference> _markersReference;
 
@@ -266,6 +314,48 @@ private:
     // controlled by the driver porgram (typically based on pre-recorded data).
     bool _advanceTimeFromReference{false};
 
+    TrackingMethod _trackingMethod{TrackingMethod::Assembler};
+    int _numIterationsInLastTrack{0};
+    int _numAssemblyStepsAfterLastSolve{0};
+
+    // A model marker (or the origin of an orientation sensor's frame) and the
+    // index of its observation in the reference data, in the order in which
+    // they were added to the Assembler's Markers (or OrientationSensors).
+    struct TrackedMarker {
+        SimTK::MobilizedBodyIndex body;
+        SimTK::Vec3 station;
+        int observationIndex;
+    };
+    struct TrackedOrientation {
+        SimTK::MobilizedBodyIndex body;
+        SimTK::Rotation R_BF;
+        int observationIndex;
+    };
+    struct ClampedCoordinate {
+        SimTK::QIndex q;
+        SimTK::UIndex u;
+        double rangeMin;
+        double rangeMax;
+    };
+    SimTK::Array_<TrackedMarker> _trackedMarkers;
+    SimTK::Array_<TrackedOrientation> _trackedOrientations;
+    // The observations of the current frame, in reference order.
+    SimTK::Array_<SimTK::Vec3> _markerObservations;
+    SimTK::Array_<SimTK::Rotation> _orientationObservations;
+    // The q of each coordinate reference in getCoordinateReferences().
+    SimTK::Array_<SimTK::QIndex> _coordinateReferenceQs;
+    // For each mobility, its column in the Gauss-Newton normal equations, or
+    // -1 if it belongs to a locked or prescribed coordinate.
+    SimTK::Array_<int> _freeIndexOfU;
+    int _numFreeMobilities{0};
+    SimTK::Array_<ClampedCoordinate> _clampedCoordinates;
+    bool _canTrackWithGaussNewton{false};
+    // The configuration found by the last call to trackGaussNewton(), which
+    // the computeCurrent*() methods use in place of the Assembler's internal
+    // state while _trackedWithGaussNewton is true.
+    SimTK::State _trackedState;
+    bool _trackedWithGaussNewton{false};
+
 //=============================================================================
 };  // END of class InverseKinematicsSolver
 //=============================================================================
@@ -0,0 +1,76 @@
+#include "ForceBuffer.h"
+
+#include <OpenSim/Common/Exception.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/PhysicalFrame.h>
+#include <OpenSim/Simulation/SimbodyEngine/Coordinate.h>
+
+OpenSim::ForceBuffer::ForceBuffer(const Model& model)
+{
+    for (const auto& frame : model.getComponentList<PhysicalFrame>()) {
+        _targetIndexOf.emplace(&frame, static_cast<int>(_targetPaths.size()));
+        _targetPaths.push_back(frame.getAbsolutePathString());
+    }
+    for (const auto& coord : model.getComponentList<Coordinate>()) {
+        _targetIndexOf.emplace(&coord, static_cast<int>(_targetPaths.size()));
+        _targetPaths.push_back(coord.getAbsolutePathString());
+    }
+}
+
+void OpenSim::ForceBuffer::clear()
+{
+    _stateBegins.clear();
+    _forceIndices.clear();
+    _kinds.clear();
+    _targetIndices.clear();
+    _points.clear();
+    _vectors.clear();
+}
+
+int OpenSim::ForceBuffer::getTargetIndex(const Component& target) const
+{
+    const auto it = _targetIndexOf.find(&target);
+    OPENSIM_THROW_IF(it == _targetIndexOf.end(), Exception,
+            "Expected '{}' to be a frame or coordinate in the model passed "
+            "to ForceBuffer.", target.getAbsolutePathString());
+    return it->second;
+}
+
+void OpenSim::ForceBuffer::append(Kind kind, int targetIndex,
+        const SimTK::Vec3& point, const SimTK::SpatialVec& vectors)
+{
+    _forceIndices.push_back(_currentForceIndex);
+    _kinds.push_back(kind);
+    _targetIndices.push_back(targetIndex);
+    _points.push_back(point);
+    _vectors.push_back(vectors);
+}
+
+void OpenSim::ForceBuffer::implConsumeGeneralizedForce(
+    const SimTK::State&,
+    const Coordinate& coord,
+    double force)
+{
+    append(Kind::GeneralizedForce, getTargetIndex(coord), SimTK::Vec3(0),
+            SimTK::SpatialVec(SimTK::Vec3(0), SimTK::Vec3(force, 0, 0)));
+}
+
+void OpenSim::ForceBuffer::implConsumeBodySpatialVec(
+    const SimTK::State&,
+    const PhysicalFrame& body,
+    const SimTK::SpatialVec& spatialVec)
+{
+    append(Kind::BodySpatialVec, getTargetIndex(body), SimTK::Vec3(0),
+            spatialVec);
+}
+
+void OpenSim::ForceBuffer::implConsumePointForce(
+    const SimTK::State& state,
+    const PhysicalFrame& frame,
+    const SimTK::Vec3& point,
+    const SimTK::Vec3& force)
+{
+    append(Kind::PointForce, getTargetIndex(frame),
+            frame.findStationLocationInGround(state, point),
+            SimTK::SpatialVec(SimTK::Vec3(0), force));
+}
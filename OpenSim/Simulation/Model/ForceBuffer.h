@@ -0,0 +1,128 @@
+#ifndef OPENSIM_FORCE_BUFFER_H_
+#define OPENSIM_FORCE_BUFFER_H_
+
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim: ForceBuffer.h                             *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/Model/ForceConsumer.h>
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OpenSim { class Component; }
+namespace OpenSim { class Model; }
+
+namespace OpenSim
+{
+
+/**
+ * A `ForceBuffer` is a concrete `ForceConsumer` that records every force it
+ * consumes, for any number of states, in struct-of-arrays buffers: entry `i`
+ * is described by `getForceIndices()[i]`, `getKinds()[i]`,
+ * `getTargetIndices()[i]`, `getPoints()[i]`, and `getVectors()[i]`. The
+ * buffers keep their capacity when cleared, so a `ForceBuffer` that is reused
+ * across states does not allocate once it has grown large enough.
+ *
+ * Call `beginState()` before producing the forces for each state, and
+ * `setForceIndex()` before each `ForceProducer::produceForces()` call, so that
+ * entries can be attributed to a state and a force.
+ *
+ * Point forces are stored with the point re-expressed in ground, so that
+ * they can be visualized without the model.
+ */
+class OSIMSIMULATION_API ForceBuffer final : public ForceConsumer {
+public:
+    /** The kind of force an entry holds. */
+    enum class Kind : int {
+        /** `getPoints()` holds the point of application (in ground) and
+        `getVectors()` holds the force (index 1); index 0 is zero. */
+        PointForce = 0,
+        /** `getVectors()` holds the torque (index 0) and force (index 1)
+        applied to the body. */
+        BodySpatialVec = 1,
+        /** `getVectors()[i][1][0]` holds the generalized force. */
+        GeneralizedForce = 2
+    };
+
+    /**
+     * Constructs a `ForceBuffer` for forces produced by components of
+     * `model`. The frames and coordinates of the model are numbered (see
+     * `getTargetPaths()`) so that entries from different copies of the same
+     * model can be compared.
+     */
+    explicit ForceBuffer(const Model& model);
+
+    /** Start recording the forces for a new state. */
+    void beginState() { _stateBegins.push_back(getNumEntries()); }
+
+    /** Attribute the entries consumed from now on to this force index. */
+    void setForceIndex(int forceIndex) { _currentForceIndex = forceIndex; }
+
+    /** Remove all entries and states, keeping the allocated capacity. */
+    void clear();
+
+    int getNumEntries() const { return static_cast<int>(_kinds.size()); }
+    int getNumStates() const { return static_cast<int>(_stateBegins.size()); }
+    /** The index of the first entry of each state (see `beginState()`). */
+    const std::vector<int>& getStateBegins() const { return _stateBegins; }
+
+    const std::vector<int>& getForceIndices() const { return _forceIndices; }
+    const std::vector<Kind>& getKinds() const { return _kinds; }
+    /** Indices into `getTargetPaths()` of the frame or coordinate to which
+    each entry applies. */
+    const std::vector<int>& getTargetIndices() const { return _targetIndices; }
+    const std::vector<SimTK::Vec3>& getPoints() const { return _points; }
+    const std::vector<SimTK::SpatialVec>& getVectors() const { return _vectors; }
+
+    /** The absolute paths of the frames and coordinates in the model, in the
+    order used by `getTargetIndices()`. */
+    const std::vector<std::string>& getTargetPaths() const {
+        return _targetPaths;
+    }
+
+private:
+    void implConsumeGeneralizedForce(const SimTK::State&, const Coordinate&, double) final;
+    void implConsumeBodySpatialVec(const SimTK::State&, const PhysicalFrame&, const SimTK::SpatialVec&) final;
+    void implConsumePointForce(const SimTK::State&, const PhysicalFrame&, const SimTK::Vec3&, const SimTK::Vec3&) final;
+
+    int getTargetIndex(const Component& target) const;
+    void append(Kind kind, int targetIndex, const SimTK::Vec3& point,
+            const SimTK::SpatialVec& vectors);
+
+    std::unordered_map<const Component*, int> _targetIndexOf;
+    std::vector<std::string> _targetPaths;
+    int _currentForceIndex = -1;
+
+    std::vector<int> _stateBegins;
+    std::vector<int> _forceIndices;
+    std::vector<Kind> _kinds;
+    std::vector<int> _targetIndices;
+    std::vector<SimTK::Vec3> _points;
+    std::vector<SimTK::SpatialVec> _vectors;
+};
+
+}  // namespace OpenSim
+
+#endif // OPENSIM_FORCE_BUFFER_H_
@@ -103,6 +103,28 @@ private:
     PointType pointType_ : 8;
 };
 
+// this is stored in a cache variable alongside the current path: the
+// position-level quantities of each point in the current path that are needed
+// to compute the path's length, lengthening speed and forces
+struct OpenSim::GeometryPath::PathPointKinematics {
+    // location of the point in its parent frame
+    SimTK::Vec3 location{SimTK::NaN};
+    // the mobilized body the point is attached to
+    SimTK::MobilizedBodyIndex bodyIndex;
+    // distance to the next point in the path (0 for the last point)
+    double distanceToNext = 0;
+    // unit vector, in ground, from this point to the next point in the path
+    // (zero if the points are coincident, and NaN for the last point)
+    SimTK::Vec3 directionToNext{SimTK::NaN};
+};
+
+// Two consecutive path points closer than this are treated as coincident: the
+// direction between them is zero, and the rate of change of the distance
+// between them is the norm of their relative velocity. Using the same
+// threshold for both avoids normalizing a segment that is too short to have a
+// reliable direction.
+static const double CoincidentPointTolerance = SimTK::SignificantReal;
+
 static void PopulatePathPointersCache(
     const OpenSim::PathPointSet& pps,
     const OpenSim::PathWrapSet& pws,
@@ -129,23 +151,6 @@ static void PopulatePathElementLookup(
     }
 }
 
-// Returns a normalized direction vector from `a` to `b` in ground, or a vector containing `NaN`s
-// if `a` and `b` are at the same location.
-//
-// Two points can be conincient due to infeasible wrapping of the path. E.g. when the origin or
-// insertion enters the wrapping surface. This is a temporary fix, since the wrap algorithm
-// should return NaN for the points and/or throw an Exception- aseth
-static SimTK::Vec3 directionBetweenPointsInGroundOrNaNIfCoincident(const SimTK::State& s, const OpenSim::AbstractPathPoint& a, const OpenSim::AbstractPathPoint& b)
-{
-    Vec3 dir = b.getLocationInGround(s) - a.getLocationInGround(s);
-    if (dir.norm() < SimTK::SignificantReal) {
-        dir = dir*SimTK::NaN;
-    }
-    else {
-        dir = dir.normalize();
-    }
-    return dir;
-}
 
 //=============================================================================
 // CONSTRUCTOR(S) AND DESTRUCTOR
@@ -209,6 +214,9 @@ void GeometryPath::extendConnectToModel(Model& aModel)
 
     // Cache the set of points currently defining this path.
     this->_currentPathCV = addCacheVariable("current_path", std::vector<PathElementLookup>{}, SimTK::Stage::Position);
+    this->_currentPathKinematicsCV = addCacheVariable(
+            "current_path_kinematics", std::vector<PathPointKinematics>{},
+            SimTK::Stage::Position);
 
     // We consider this cache entry valid any time after it has been created
     // and first marked valid, and we won't ever invalidate it.
@@ -411,11 +419,14 @@ void GeometryPath::produceForces(const SimTK::State& s,
     MobilizedBodyIndex previousBodyIndex = MobilizedBodyIndex::Invalid();
     SimTK::Vec3 previousDirection(0.0);
 
+    // The body attachments and directions were computed along with the path.
     const Array<AbstractPathPoint*>& currentPath = getCurrentPath(s);
+    const std::vector<PathPointKinematics>& kinematics =
+            getCacheVariableValue(s, _currentPathKinematicsCV);
     for (int i = 0; i < currentPath.getSize(); ++i) {
 
         const AbstractPathPoint& currentPoint = *currentPath[i];
-        const MobilizedBodyIndex currentBodyIndex = currentPoint.getParentFrame().getMobilizedBodyIndex();
+        const MobilizedBodyIndex currentBodyIndex = kinematics[i].bodyIndex;
 
         SimTK::Vec3 force(0.0);
         if (previousBodyIndex.isValid() && currentBodyIndex != previousBodyIndex) {
@@ -423,8 +434,8 @@ void GeometryPath::produceForces(const SimTK::State& s,
         }
 
         const AbstractPathPoint* nextPoint = i < currentPath.getSize()-1 ? currentPath[i+1] : nullptr;
-        if (nextPoint && nextPoint->getParentFrame().getMobilizedBodyIndex() != currentBodyIndex) {
-            const SimTK::Vec3 currentDirection = directionBetweenPointsInGroundOrNaNIfCoincident(s, currentPoint, *nextPoint);
+        if (nextPoint && kinematics[i+1].bodyIndex != currentBodyIndex) {
+            const SimTK::Vec3& currentDirection = kinematics[i].directionToNext;
             const SimTK::Vec3 currentToNextForce = tension * currentDirection;
             force += currentToNextForce;
 
@@ -451,7 +462,7 @@ void GeometryPath::produceForces(const SimTK::State& s,
 
         // If applicable, produce the force
         if (force != SimTK::Vec3(0.0)) {
-            forceConsumer.consumePointForce(s, currentPoint.getParentFrame(), currentPoint.getLocation(s), force);
+            forceConsumer.consumePointForce(s, currentPoint.getParentFrame(), kinematics[i].location, force);
         }
     }
 }
@@ -842,7 +853,8 @@ extendPostScale(const SimTK::State& s, const ScaleSet& scaleSet)
  */
 void GeometryPath::computePath(const SimTK::State& s) const
 {
-    if (isCacheVariableValid(s, _currentPathCV)) {
+    if (isCacheVariableValid(s, _currentPathCV) &&
+            isCacheVariableValid(s, _currentPathKinematicsCV)) {
         // even though the cache variable is valid, re-populate the pointers cache
         //
         // this is because although it may be valid *in the state* the
@@ -867,7 +879,7 @@ void GeometryPath::computePath(const SimTK::State& s) const
     // Use the current path so far to check for intersection with wrap objects, 
     // which may add additional points to the path.
     applyWrapObjects(s, _currentPathPtrsCache);
-    calcLengthAfterPathComputation(s, _currentPathPtrsCache);
+    computePathPointKinematics(s, _currentPathPtrsCache);
 
     // the pointers array now contains the "correct" (wrapped) path
     //
@@ -898,11 +910,23 @@ void GeometryPath::computeLengtheningSpeed(const SimTK::State& s) const
     }
 
     const Array<AbstractPathPoint*>& currentPath = getCurrentPath(s);
+    const std::vector<PathPointKinematics>& kinematics =
+            getCacheVariableValue(s, _currentPathKinematicsCV);
 
+    // Sum the rate of change of each segment's length. This matches
+    // Point::calcSpeedBetween(), but uses the distances and directions that
+    // were computed with the path, treats points as coincident with the same
+    // tolerance as those directions, and evaluates each point's velocity once.
     double speed = 0.0;
-    
+    Vec3 velocity = currentPath[0]->getVelocityInGround(s);
     for (int i = 0; i < currentPath.getSize() - 1; i++) {
-        speed += currentPath[i]->calcSpeedBetween(s, *currentPath[i+1]);
+        const Vec3 nextVelocity = currentPath[i+1]->getVelocityInGround(s);
+        const Vec3 relativeVelocity = nextVelocity - velocity;
+        if (kinematics[i].distanceToNext < CoincidentPointTolerance)
+            speed += relativeVelocity.norm();
+        else
+            speed += dot(relativeVelocity, kinematics[i].directionToNext);
+        velocity = nextVelocity;
     }
 
     setLengtheningSpeed(s, speed);
@@ -1192,6 +1216,63 @@ calcLengthAfterPathComputation(const SimTK::State& s,
     return( length );
 }
 
+//_____________________________________________________________________________
+/*
+ * Compute the length of the final (wrapped) path, along with the location,
+ * body and direction to the next point of each point in the path, in a single
+ * pass over the path.
+ */
+void GeometryPath::
+computePathPointKinematics(const SimTK::State& s,
+                           const Array<AbstractPathPoint*>& currentPath) const
+{
+    std::vector<PathPointKinematics>& kinematics =
+            updCacheVariableValue(s, _currentPathKinematicsCV);
+    kinematics.resize(currentPath.getSize());
+
+    double length = 0.0;
+    const AbstractPathPoint* p1 = currentPath[0];
+    Vec3 p1InGround = p1->getLocationInGround(s);
+    for (int i = 0; i < currentPath.getSize(); i++) {
+        kinematics[i].location = p1->getLocation(s);
+        kinematics[i].bodyIndex = p1->getParentFrame().getMobilizedBodyIndex();
+        if (i == currentPath.getSize() - 1) {
+            kinematics[i].distanceToNext = 0;
+            kinematics[i].directionToNext = Vec3(SimTK::NaN);
+            break;
+        }
+
+        const AbstractPathPoint* p2 = currentPath[i+1];
+        const Vec3 p2InGround = p2->getLocationInGround(s);
+        const Vec3 segment = p2InGround - p1InGround;
+        const double distance = segment.norm();
+        kinematics[i].distanceToNext = distance;
+        // Two points can be coincident due to infeasible wrapping of the
+        // path. E.g. when the origin or insertion enters the wrapping
+        // surface. Such points apply no force along the segment between
+        // them.
+        kinematics[i].directionToNext = distance < CoincidentPointTolerance ?
+                Vec3(0) : segment / distance;
+
+        // Same as calcLengthAfterPathComputation().
+        if (   p1->getWrapObject()
+            && p2->getWrapObject()
+            && p1->getWrapObject() == p2->getWrapObject())
+        {
+            const PathWrapPoint* smwp = dynamic_cast<const PathWrapPoint*>(p2);
+            if (smwp)
+                length += smwp->getWrapLength(s);
+        } else {
+            length += distance;
+        }
+        p1 = p2;
+        p1InGround = p2InGround;
+    }
+    markCacheVariableValid(s, _currentPathKinematicsCV);
+
+    setLength(s, length);
+}
+
 //_____________________________________________________________________________
 /*
  * Compute the path's moment arms for  specified coordinate.
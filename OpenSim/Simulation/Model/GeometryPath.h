@@ -80,8 +80,13 @@ private:
     mutable CacheVariable<double> _speedCV;
 public:
     class PathElementLookup;
+    struct PathPointKinematics;
 private:
     mutable CacheVariable<std::vector<PathElementLookup>> _currentPathCV;
+    // Position-level quantities for each point in the current path, computed
+    // alongside the current path and reused for speed and force computations.
+    mutable CacheVariable<std::vector<PathPointKinematics>>
+        _currentPathKinematicsCV;
     mutable CacheVariable<SimTK::Vec3> _colorCV;
     
 //=============================================================================
@@ -213,6 +218,8 @@ private:
                                 const Array<AbstractPathPoint*>& path) const; 
     double calcLengthAfterPathComputation
        (const SimTK::State& s, const Array<AbstractPathPoint*>& currentPath) const;
+    void computePathPointKinematics(const SimTK::State& s,
+        const Array<AbstractPathPoint*>& currentPath) const;
 
     void constructProperties();
     void namePathPoints(int aStartingIndex);
@@ -46,6 +46,7 @@
 #include <OpenSim/Common/Logger.h>
 #include <OpenSim/Common/ScaleSet.h>
 #include <OpenSim/Common/Storage.h>
+#include <OpenSim/Common/TableUtilities.h>
 #include <OpenSim/Common/XMLDocument.h>
 #include <OpenSim/Simulation/AssemblySolver.h>
 #include <OpenSim/Simulation/CoordinateReference.h>
@@ -1105,6 +1106,15 @@ void Model::extendAddToSystem(SimTK::MultibodySystem& system) const
         Stage::Velocity, Stage::Acceleration);
 
     mutableThis->_modelControlsIndex = modelControls.getSubsystemMeasureIndex();
+
+    // Reaction loads depend on accelerations and are therefore invalidated
+    // whenever Stage::Acceleration is.
+    this->_mobilizerReactionsCV = addCacheVariable("mobilizer_reactions_in_g",
+            SimTK::Vector_<SimTK::SpatialVec>{}, SimTK::Stage::Acceleration);
+
+    // Speed coupling depends only on the configuration.
+    this->_speedCouplingCV = addCacheVariable("speed_coupling",
+            SimTK::Matrix{}, SimTK::Stage::Position);
 }
 
 
@@ -2098,10 +2108,16 @@ void Model::formStateStorage(const Storage& originalStorage,
     SimTK::Vector defaultStateValues = getStateVariableValues(getWorkingState());
 
     // Create a list with entry for each desiredName telling which column in originalStorage has the data
+    // (Same as calling originalStorage.getStateIndex() for each name, but the
+    // column labels are only searched once.)
+    const std::vector<int> columnIndices =
+            TableUtilities::findStateLabelIndices(
+                    originalStorage.getColumnLabels(), rStateNames);
     Array<int> mapColumns(-1, rStateNames.getSize());
     for(int i=0; i< rStateNames.getSize(); i++){
-        // the index is -1 if not found, >=1 otherwise since time has index 0 by defn.
-        int fix = originalStorage.getStateIndex(rStateNames[i]);
+        // the index is -1 if not found, >=0 otherwise since time has index 0
+        // in the column labels but not in the state vector.
+        int fix = columnIndices[i] == -1 ? -1 : columnIndices[i] - 1;
         mapColumns[i] = fix;
         if (fix==-1 && warnUnspecifiedStates){
             log_warn("Column {} not found by Model::formStateStorage(). "
@@ -2291,6 +2307,68 @@ SimTK::Vec3 Model::calcMassCenterAcceleration(const SimTK::State &s) const
     return getMatterSubsystem().calcSystemMassCenterAccelerationInGround(s);
 }
 
+const SimTK::Vector_<SimTK::SpatialVec>& Model::getMobilizerReactionsInGround(
+        const SimTK::State& s) const
+{
+    if (isCacheVariableValid(s, _mobilizerReactionsCV)) {
+        return getCacheVariableValue(s, _mobilizerReactionsCV);
+    }
+
+    SimTK::Vector_<SimTK::SpatialVec>& reactions =
+            updCacheVariableValue(s, _mobilizerReactionsCV);
+    getMatterSubsystem().calcMobilizerReactionForces(s, reactions);
+    markCacheVariableValid(s, _mobilizerReactionsCV);
+    return reactions;
+}
+
+const SimTK::Matrix& Model::getSpeedCouplingMatrix(const SimTK::State& s) const
+{
+    if (isCacheVariableValid(s, _speedCouplingCV)) {
+        return getCacheVariableValue(s, _speedCouplingCV);
+    }
+
+    getMultibodySystem().realize(s, Stage::Position);
+    const int nu = s.getNU();
+    SimTK::Matrix& coupling = updCacheVariableValue(s, _speedCouplingCV);
+    coupling.resize(nu, nu);
+    coupling = 0;
+    coupling.updDiag() = 1;
+
+    // Velocity constraint Jacobian G (holonomic and nonholonomic rows).
+    SimTK::Matrix G;
+    getMatterSubsystem().calcG(s, G);
+    if (G.nrow() > 0) {
+        SimTK_ASSERT_ALWAYS(G.ncol() == nu,
+                "Model::getSpeedCouplingMatrix(): expected all generalized "
+                "speeds to belong to the matter subsystem.");
+        // Project every unit speed onto the constraint manifold at once with
+        // the same weighted minimum-norm correction that
+        // SimTK::System::projectU() applies:
+        //     U = I - W^-1 (G W^-1)^+ G,
+        // where W holds the speed weights.
+        const SimTK::Vector& w = s.getUWeights();
+        SimTK::Matrix GWinv = G;
+        for (int j = 0; j < nu; ++j) GWinv.updCol(j) /= w[j];
+        SimTK::FactorQTZ qtz(GWinv);
+        SimTK::Matrix correction;
+        qtz.solve(G, correction);
+        for (int i = 0; i < nu; ++i) correction.updRow(i) /= w[i];
+        coupling -= correction;
+
+        // Normalize by the resulting speed of the perturbed coordinate.
+        for (int j = 0; j < nu; ++j) {
+            const double ujj = coupling(j, j);
+            if (std::abs(ujj) > SimTK::SignificantReal) {
+                coupling.updCol(j) /= ujj;
+            } else {
+                coupling.updCol(j) = 0;
+            }
+        }
+    }
+    markCacheVariableValid(s, _speedCouplingCV);
+    return coupling;
+}
+
 SimTK::SpatialVec Model::calcMomentum(const SimTK::State &s) const
 {
     getMultibodySystem().realize(s, Stage::Velocity);
@@ -893,6 +893,40 @@ public:
      */
     SimTK::Vec3 calcMassCenterAcceleration(const SimTK::State &s) const;
 
+    /**
+     * Get the reaction loads of all mobilizers in the underlying
+     * SimbodyMatterSubsystem, indexed by SimTK::MobilizedBodyIndex. Each entry
+     * is the spatial force (torque, force) applied by the parent onto the
+     * child body at the child's mobilizer frame M, expressed in Ground.
+     *
+     * Simbody computes the reaction loads for the whole tree at once, so the
+     * result is computed in a single O(n) pass and cached in the State until
+     * the Acceleration stage is invalidated. Joint::calcReactionOnChildExpressedInGround(),
+     * Joint::calcReactionOnParentExpressedInGround() and the analyses and
+     * goals built on them all share this cached result.
+     *
+     * The supplied State must be realized to %Acceleration stage.
+     */
+    const SimTK::Vector_<SimTK::SpatialVec>& getMobilizerReactionsInGround(
+            const SimTK::State& s) const;
+
+    /**
+     * Get the coupling between generalized speeds imposed by the enabled
+     * constraints (e.g., coordinate couplers and patellar constraints). Column
+     * j holds the generalized speeds that result from setting u_j = 1 and
+     * projecting onto the velocity constraints, scaled so that entry j is 1.
+     * Columns for speeds that the constraints do not allow to change (e.g., of
+     * locked coordinates) are zero.
+     *
+     * The couplings for all speeds are computed from a single factorization
+     * of the constraint Jacobian and cached in the State until the Position
+     * stage is invalidated, so that every moment-arm calculation at the same
+     * configuration shares them (see MomentArmSolver).
+     *
+     * The supplied State is realized to %Position stage if necessary.
+     */
+    const SimTK::Matrix& getSpeedCouplingMatrix(const SimTK::State& s) const;
+
     /**
      * Return the spatial momentum about the system mass center expressed in
      * Ground.
@@ -1263,6 +1297,15 @@ private:
     // >5%.
     std::vector<std::reference_wrapper<const Controller>> _enabledControllers{};
 
+    // Reaction loads of all mobilizers, at M and expressed in Ground, shared
+    // by all Joints (see getMobilizerReactionsInGround()).
+    mutable CacheVariable<SimTK::Vector_<SimTK::SpatialVec>>
+            _mobilizerReactionsCV;
+
+    // Constraint coupling between generalized speeds (see
+    // getSpeedCouplingMatrix()).
+    mutable CacheVariable<SimTK::Matrix> _speedCouplingCV;
+
     //--------------------------------------------------------------------------
     //                              RUN TIME 
     //--------------------------------------------------------------------------
@@ -28,6 +28,7 @@
 #include <simbody/internal/Visualizer_InputListener.h>
 #include <simbody/internal/Visualizer_Reporter.h>
 
+#include <algorithm>
 #include <string>
 using std::string;
 #include <iostream>
@@ -122,11 +123,76 @@ void DefaultGeometry::generateDecorations
    (const State&                         state, 
     Array_<SimTK::DecorativeGeometry>&   geometry) 
 {
+    if (_decorationBuffer) {
+        // Sample the "Show" menu toggles for this frame, and draw the buffered
+        // geometry only if it was generated with the same toggles.
+        const ModelDisplayHints hints = _model.getDisplayHints();
+        if (_decorationBuffer->appendGeometryAtTime(
+                    state.getTime(), hints, geometry)) {
+            return;
+        }
+        const auto lock = _decorationBuffer->lockModel();
+        _model.generateDecorations(false, hints, state, geometry);
+        return;
+    }
+
     // Ask all the ModelComponents to generate dynamic geometry.
     _model.generateDecorations(false, _model.getDisplayHints(),
                                state, geometry);
 }
 
+//==============================================================================
+//                           DECORATION BUFFER
+//==============================================================================
+DecorationBuffer::DecorationBuffer(std::vector<double> times)
+    :   _times(std::move(times)) {
+    _frames.reserve(_times.size());
+}
+
+void DecorationBuffer::appendFrame(Array_<DecorativeGeometry> geometry,
+        const ModelDisplayHints& hints) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        OPENSIM_ASSERT(!_closed && _frames.size() < _times.size());
+        _frames.push_back(std::move(geometry));
+        if (_hints.empty() || !(_hints.back() == hints)) {
+            _hints.push_back(hints);
+        }
+        _frameHints.push_back((int)_hints.size() - 1);
+    }
+    _frameAppended.notify_all();
+}
+
+void DecorationBuffer::close() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+    }
+    _frameAppended.notify_all();
+}
+
+bool DecorationBuffer::waitForFrame(int frame) const {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _frameAppended.wait(lock, [&] {
+        return (int)_frames.size() > frame || _closed;
+    });
+    return (int)_frames.size() > frame;
+}
+
+bool DecorationBuffer::appendGeometryAtTime(double time,
+        const ModelDisplayHints& hints,
+        Array_<DecorativeGeometry>& geometry) const {
+    if (_times.empty()) return false;
+    auto it = std::upper_bound(_times.begin(), _times.end(), time);
+    const size_t frame = it == _times.begin() ? 0 : (it - _times.begin()) - 1;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (frame >= _frames.size()) return false;
+    if (!(_hints[_frameHints[frame]] == hints)) return false;
+    for (const auto& geom : _frames[frame]) geometry.push_back(geom);
+    return true;
+}
+
 //==============================================================================
 //                            MODEL VISUALIZER
 //==============================================================================
@@ -30,8 +30,14 @@ that uses the OpenSim API. **/
 
 #include <OpenSim/Common/Assertion.h>
 #include <OpenSim/Simulation/osimSimulationDLL.h>
+#include <OpenSim/Common/ModelDisplayHints.h>
 #include <simbody/internal/Visualizer.h>
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace OpenSim {
 class Model;
 }
@@ -39,13 +45,72 @@ class Model;
 #ifndef SWIG
 namespace SimTK {
 
+//==============================================================================
+//                           DECORATION BUFFER
+//==============================================================================
+// Dynamic (non-fixed) geometry for each frame of a motion, generated ahead of
+// playback so that drawing a frame does not require calling
+// generateDecorations() on every component (e.g., recomputing wrapped paths).
+// Frames are appended in order by a producer, typically a background thread,
+// while earlier frames are already being drawn; access is synchronized. Each
+// frame remembers the display hints (the "Show" menu toggles) it was generated
+// with, so that a frame is only drawn from the buffer if the toggles have not
+// changed since.
+class OSIMSIMULATION_API DecorationBuffer {
+public:
+    // The times of the frames, in increasing order; these are used to select
+    // the frame to draw for a given State.
+    explicit DecorationBuffer(std::vector<double> times);
+
+    int getNumFrames() const { return (int)_times.size(); }
+
+    // Store the geometry for the next frame, generated with the given display
+    // hints, and wake up waiting readers.
+    void appendFrame(Array_<DecorativeGeometry> geometry,
+            const OpenSim::ModelDisplayHints& hints);
+
+    // Mark that no more frames will be appended (e.g., the producer failed
+    // or was cancelled) and wake up waiting readers.
+    void close();
+
+    // Block until the frame with the given index is available. Returns false
+    // if the buffer was closed before the frame was appended.
+    bool waitForFrame(int frame) const;
+
+    // Append the geometry of the frame whose time is closest to, but not
+    // after, the given time, and return true. Nothing is appended, and false
+    // is returned, if that frame is not yet available or was generated with
+    // display hints other than the given ones.
+    bool appendGeometryAtTime(double time,
+            const OpenSim::ModelDisplayHints& hints,
+            Array_<DecorativeGeometry>& geometry) const;
+
+    // The producer holds this lock while it realizes a State and generates
+    // its geometry, and so does anyone generating geometry from the same
+    // Model on another thread.
+    std::unique_lock<std::mutex> lockModel() const
+    {   return std::unique_lock<std::mutex>(_modelMutex); }
+
+private:
+    const std::vector<double> _times;
+    std::vector<Array_<DecorativeGeometry>> _frames;
+    // The display hints used for each frame, as an index into _hints, which
+    // holds each distinct set of hints once.
+    std::vector<int> _frameHints;
+    std::vector<OpenSim::ModelDisplayHints> _hints;
+    bool _closed = false;
+    mutable std::mutex _mutex;
+    mutable std::condition_variable _frameAppended;
+    mutable std::mutex _modelMutex;
+};
+
 //==============================================================================
 //                           DEFAULT GEOMETRY
 //==============================================================================
 // This class implements a SimTK DecorationGenerator. We'll add one to the
 // Visualizer so it can invoke the generateDecorations() dispatcher to pick up 
 // per-frame geometry.
-class DefaultGeometry : public DecorationGenerator {
+class OSIMSIMULATION_API DefaultGeometry : public DecorationGenerator {
 public:
     DefaultGeometry(OpenSim::Model& model) : _model(model) {
         _dispMarkerRadius = 0.005;
@@ -72,6 +137,14 @@ public:
     double getDispContactResolution() {return _dispContactResolution;}
     void   setDispContactResolution(double a) {_dispContactResolution=a;}
 
+    // If a buffer is set, dynamic geometry is drawn from the buffer instead of
+    // being generated by the model. The display toggles in the "Show" menu are
+    // sampled for every frame; a frame whose buffered geometry was generated
+    // with other toggles is generated by the model instead. Pass nullptr to
+    // resume generating all geometry from the model.
+    void setDecorationBuffer(std::shared_ptr<const DecorationBuffer> buffer)
+    {   _decorationBuffer = std::move(buffer); }
+
 static void drawPathPoint(const SimTK::MobilizedBodyIndex&             body,
                           const SimTK::Vec3&                           pt_B,
                           const SimTK::Vec3&                           color,
@@ -87,6 +160,8 @@ private:
     double _dispWrapResolution;
     double  _dispContactOpacity;
     double _dispContactResolution;
+
+    std::shared_ptr<const DecorationBuffer> _decorationBuffer;
 };
 
 }
@@ -65,8 +65,8 @@ double MomentArmSolver::solve(const State &state, const Coordinate &aCoord,
     State& s_ma = _stateCopy;
     s_ma.updQ() = state.getQ();
 
-    // compute the coupling between coordinates due to constraints
-    _coupling = computeCouplingVector(s_ma, aCoord);
+    // get the coupling between coordinates due to constraints
+    updCouplingVector(state, aCoord);
 
     // set speeds to zero
     s_ma.updU() = 0;
@@ -104,8 +104,8 @@ double MomentArmSolver::solve(const State &state, const Coordinate &aCoord,
     State& s_ma = _stateCopy;
     s_ma.updQ() = state.getQ();
 
-    // compute the coupling between coordinates due to constraints
-    _coupling = computeCouplingVector(s_ma, aCoord);
+    // get the coupling between coordinates due to constraints
+    updCouplingVector(state, aCoord);
 
     // set speeds to zero
     s_ma.updU() = 0;
@@ -132,6 +132,27 @@ double MomentArmSolver::solve(const State &state, const Coordinate &aCoord,
     return ~_coupling*_generalizedForces;
 }
 
+void MomentArmSolver::updCouplingVector(const State& state,
+        const Coordinate& coordinate) const
+{
+    // The model caches the coupling of all speeds for the current
+    // configuration, so all paths crossing this coordinate share it. The
+    // cached coupling holds locked coordinates fixed, however, so for a
+    // locked coordinate of interest we unlock it in our copy of the state and
+    // project its speed alone.
+    if (coordinate.getLocked(state)) {
+        _coupling = computeCouplingVector(_stateCopy, coordinate);
+        return;
+    }
+
+    const auto& matter = getModel().getMatterSubsystem();
+    const int uIndex = state.getUStart(matter.getMySubsystemIndex()) +
+            matter.getMobilizedBody(coordinate.getBodyIndex())
+                    .getFirstUIndex(state) +
+            coordinate.getMobilizerQIndex();
+    _coupling = getModel().getSpeedCouplingMatrix(state).col(uIndex);
+}
+
 SimTK::Vector MomentArmSolver::computeCouplingVector(SimTK::State &state, 
         const Coordinate &coordinate) const
 {
@@ -96,7 +96,12 @@ private:
     // Keep preallocated vector of the coupling constraint factors
     mutable SimTK::Vector _coupling;
 
-    // compute vector of constraint coupling factors
+    // update _coupling with the constraint coupling factors for the
+    // coordinate, using the model's cached coupling where possible
+    void updCouplingVector(const SimTK::State& state,
+        const Coordinate& coordinate) const;
+
+    // compute vector of constraint coupling factors by projection
     SimTK::Vector computeCouplingVector(SimTK::State &state, 
         const Coordinate &coordinate) const;
 //=============================================================================
@@ -656,6 +656,17 @@ void Coordinate::CoordinateStateVariable::
     throw Exception(msg);
 }
 
+SimTK::SystemYIndex Coordinate::CoordinateStateVariable::
+    findSystemYIndex(const SimTK::State& state) const
+{
+    const Coordinate& owner = *((Coordinate *)&getOwner());
+    const SimbodyMatterSubsystem& matter = owner.getModel().getMatterSubsystem();
+    const MobilizedBody& mb = matter.getMobilizedBody(owner.getBodyIndex());
+    return SimTK::SystemYIndex(state.getQStart() +
+            state.getQStart(matter.getMySubsystemIndex()) +
+            mb.getFirstQIndex(state) + owner.getMobilizerQIndex());
+}
+
 
 //-----------------------------------------------------------------------------
 // Coordinate::SpeedStateVariable
@@ -692,6 +703,17 @@ void Coordinate::SpeedStateVariable::
     throw Exception(msg);
 }
 
+SimTK::SystemYIndex Coordinate::SpeedStateVariable::
+    findSystemYIndex(const SimTK::State& state) const
+{
+    const Coordinate& owner = *((Coordinate *)&getOwner());
+    const SimbodyMatterSubsystem& matter = owner.getModel().getMatterSubsystem();
+    const MobilizedBody& mb = matter.getMobilizedBody(owner.getBodyIndex());
+    return SimTK::SystemYIndex(state.getUStart() +
+            state.getUStart(matter.getMySubsystemIndex()) +
+            mb.getFirstUIndex(state) + owner.getMobilizerQIndex());
+}
+
 //=============================================================================
 // XML Deserialization
 //=============================================================================
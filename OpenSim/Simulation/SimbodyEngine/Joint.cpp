@@ -378,6 +378,29 @@ SimTK::SpatialVec Joint::calcEquivalentSpatialForce(const SimTK::State &s,
     return FB_G;
 }
 
+SimTK::SpatialVec Joint::calcReactionOnParentExpressedInGround(
+        const SimTK::State& s) const
+{
+    // Shift the reaction on the child at M to the parent's F and negate it,
+    // which is what MobilizedBody::findMobilizerReactionOnParentAtFInGround()
+    // does, but without recomputing the reactions of the entire tree.
+    const SimTK::MobilizedBody& mobod = getChildFrame().getMobilizedBody();
+    const SimTK::SpatialVec reactionOnChildAtM =
+            calcReactionOnChildExpressedInGround(s);
+    const SimTK::Vec3 p_GF = mobod.getParentMobilizedBody()
+            .findFrameTransformInGround(s, mobod.getInboardFrame(s)).p();
+    const SimTK::Vec3 p_GM =
+            mobod.findFrameTransformInGround(s, mobod.getOutboardFrame(s)).p();
+    return -SimTK::shiftForceBy(reactionOnChildAtM, p_GF - p_GM);
+}
+
+SimTK::SpatialVec Joint::calcReactionOnChildExpressedInGround(
+        const SimTK::State& s) const
+{
+    return getModel().getMobilizerReactionsInGround(s)[
+            getChildFrame().getMobilizedBodyIndex()];
+}
+
 /** Joints only produce power when internal constraint forces have components along
     the mobilities of the joint (for example to satisfy prescribed motion). In 
     which case the joint power is the constraint forces projected onto the mobilities
@@ -31,8 +31,16 @@
 #include <OpenSim/Common/TableUtilities.h>
 #include <OpenSim/Common/CommonUtilities.h>
 #include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/Parallel.h>
+#include <OpenSim/Simulation/Model/ForceBuffer.h>
+#include <OpenSim/Simulation/Model/ForceProducer.h>
 #include <OpenSim/Simulation/SimbodyEngine/CoordinateCouplerConstraint.h>
 
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <tuple>
+
 using namespace OpenSim;
 
 SimTK::State OpenSim::simulate(Model& model,
@@ -105,8 +113,10 @@ void OpenSim::updateStateLabels40(const Model& model,
     TableUtilities::checkNonUniqueLabels(labels);
 
     const Array<std::string> stateNames = model.getStateVariableNames();
+    const std::vector<int> indices =
+            TableUtilities::findStateLabelIndices(labels, stateNames);
     for (int isv = 0; isv < stateNames.size(); ++isv) {
-        int i = TableUtilities::findStateLabelIndex(labels, stateNames[isv]);
+        int i = indices[isv];
         if (i == -1) continue;
         labels[i] = stateNames[isv];
     }
@@ -399,8 +409,6 @@ TimeSeriesTableVec3 OpenSim::createSyntheticIMUAccelerationSignals(
         const Model& model,
         const TimeSeriesTable& statesTable, const TimeSeriesTable& controlsTable,
         const std::vector<std::string>& framePaths) {
-    std::vector<std::string> outputPaths;
-
     ComponentPath path;
     for (const auto& framePath : framePaths) {
         OPENSIM_THROW_IF(path.isLegalPathElement(framePath), Exception,
@@ -409,37 +417,285 @@ TimeSeriesTableVec3 OpenSim::createSyntheticIMUAccelerationSignals(
             !model.hasComponent<PhysicalFrame>(framePath), Exception,
             "Expected provided frame path '{}' to point to component of "
             "type PhysicalFrame, but no such component was found.", framePath);
-        outputPaths.push_back(framePath + "\\|linear_acceleration");
     }
-    TimeSeriesTableVec3 accelTableEffort = analyze<SimTK::Vec3>(
-            model, statesTable, controlsTable, outputPaths);
+    return createSyntheticIMUSignals(model, statesTable, controlsTable,
+            framePaths).linearAccelerations;
+}
 
-    // Create synthetic IMU signals by extracting the gravitational acceleration
-    // vector from the solution accelerations and expressing them in the model
-    // frames.
-    const auto& statesTraj =
-            StatesTrajectory::createFromStatesTable(model, statesTable);
-    const auto& ground = model.getGround();
-    const auto& gravity = model.getGravity();
-    const auto& timeVec = accelTableEffort.getIndependentColumn();
-    TimeSeriesTableVec3 accelTableIMU(timeVec);
+SyntheticIMUSignals OpenSim::createSyntheticIMUSignals(const Model& model,
+        const TimeSeriesTable& statesTable,
+        const TimeSeriesTable& controlsTable,
+        const std::vector<std::string>& framePaths, int numThreads) {
+    OPENSIM_THROW_IF(numThreads < 0, Exception,
+            "Expected the number of threads to be non-negative, but received "
+            "{}.", numThreads);
     for (const auto& framePath : framePaths) {
-        std::string label = framePath + "|linear_acceleration";
-        const auto& col = accelTableEffort.getDependentColumn(label);
-        const auto& frame = model.getComponent<PhysicalFrame>(framePath);
-        SimTK::Vector_<SimTK::Vec3> colIMU(col.size());
-        for (int i = 0; i < (int)timeVec.size(); ++i) {
-            const auto& state = statesTraj.get(i);
-            model.realizeAcceleration(state);
-            SimTK::Vec3 accelIMU = ground.expressVectorInAnotherFrame(
-                    state, col[i] - gravity, frame);
-            colIMU[i] = accelIMU;
+        OPENSIM_THROW_IF(
+            !model.hasComponent<PhysicalFrame>(framePath), Exception,
+            "Expected provided frame path '{}' to point to component of "
+            "type PhysicalFrame, but no such component was found.", framePath);
+    }
+    OPENSIM_THROW_IF(statesTable.getNumRows() != controlsTable.getNumRows(),
+            Exception,
+            "Expected statesTable and controlsTable to contain the "
+            "same number of rows, but statesTable contains {} rows "
+            "and controlsTable contains {} rows.",
+            statesTable.getNumRows(), controlsTable.getNumRows());
+
+    const auto statesTraj =
+            StatesTrajectory::createFromStatesTable(model, statesTable);
+    const int numRows = static_cast<int>(statesTraj.getSize());
+    const int numFrames = static_cast<int>(framePaths.size());
+    if (numThreads == 0) numThreads = ThreadPool::getDefault().getNumThreads();
+    // Copying and initializing a model for a block of states is only worth
+    // it if the block contains at least this many states.
+    constexpr int minStatesPerBlock = 32;
+    const int numBlocks = std::max(1,
+            std::min(numThreads, numRows / minStatesPerBlock));
+
+    // Copy the model serially; each block initializes and uses its own copy.
+    std::vector<std::unique_ptr<Model>> models;
+    for (int block = 0; block < numBlocks; ++block) {
+        models.emplace_back(new Model(model));
+    }
+
+    SimTK::Matrix_<SimTK::Quaternion> orientations(numRows, numFrames);
+    SimTK::Matrix_<SimTK::Vec3> angularVelocities(numRows, numFrames);
+    SimTK::Matrix_<SimTK::Vec3> linearAccelerations(numRows, numFrames);
+    const std::vector<std::string>& controlNames =
+            controlsTable.getColumnLabels();
+    parallelForChunks(numBlocks, [&](int block) {
+        Model& localModel = *models[block];
+        SimTK::State state = localModel.initSystem();
+        const auto& ground = localModel.getGround();
+        const SimTK::Vec3& gravity = localModel.getGravity();
+        std::vector<const PhysicalFrame*> frames;
+        for (const auto& framePath : framePaths) {
+            frames.push_back(
+                    &localModel.getComponent<PhysicalFrame>(framePath));
+        }
+        const std::unordered_map<std::string, int> controlMap =
+                createSystemControlIndexMap(localModel);
+        std::vector<int> controlIndices;
+        for (const auto& name : controlNames) {
+            controlIndices.push_back(controlMap.at(name));
+        }
+        SimTK::Vector controls((int)controlMap.size(), 0.0);
+
+        const int begin = static_cast<int>(
+                static_cast<long long>(numRows) * block / numBlocks);
+        const int end = static_cast<int>(
+                static_cast<long long>(numRows) * (block + 1) / numBlocks);
+        for (int itime = begin; itime < end; ++itime) {
+            state.setTime(statesTraj[itime].getTime());
+            state.updY() = statesTraj[itime].getY();
+
+            // Enforce any SimTK::Motion's included in the model.
+            localModel.getSystem().prescribe(state);
+
+            const auto& controlsRow = controlsTable.getRowAtIndex(itime);
+            for (int ic = 0; ic < (int)controlIndices.size(); ++ic) {
+                controls[controlIndices[ic]] = controlsRow[ic];
+            }
+            localModel.realizeVelocity(state);
+            localModel.setControls(state, controls);
+            localModel.realizeAcceleration(state);
+
+            for (int iframe = 0; iframe < numFrames; ++iframe) {
+                const PhysicalFrame& frame = *frames[iframe];
+                orientations(itime, iframe) = SimTK::Quaternion(
+                        frame.getTransformInGround(state).R());
+                angularVelocities(itime, iframe) =
+                        ground.expressVectorInAnotherFrame(state,
+                                frame.getAngularVelocityInGround(state),
+                                frame);
+                linearAccelerations(itime, iframe) =
+                        ground.expressVectorInAnotherFrame(state,
+                                frame.getLinearAccelerationInGround(state) -
+                                        gravity,
+                                frame);
+            }
         }
-        accelTableIMU.appendColumn(label, colIMU);
+    }, numThreads);
+
+    std::vector<double> times(numRows);
+    for (int itime = 0; itime < numRows; ++itime) {
+        times[itime] = statesTraj[itime].getTime();
+    }
+    SyntheticIMUSignals signals;
+    signals.orientations =
+            TimeSeriesTableQuaternion(times, orientations, framePaths);
+    signals.angularVelocities =
+            TimeSeriesTableVec3(times, angularVelocities, framePaths);
+    signals.linearAccelerations =
+            TimeSeriesTableVec3(times, linearAccelerations, framePaths);
+    return signals;
+}
+
+TimeSeriesTable OpenSim::createProducedForcesTable(const Model& model,
+        const StatesTrajectory& states, int numThreads) {
+    OPENSIM_THROW_IF(numThreads < 0, Exception,
+            "Expected the number of threads to be non-negative, but received "
+            "{}.", numThreads);
+    const int numStates = static_cast<int>(states.getSize());
+    if (numThreads == 0) numThreads = ThreadPool::getDefault().getNumThreads();
+    const int numBlocks = std::max(1, std::min(numThreads, numStates));
+    auto blockBegin = [&](int block) {
+        return static_cast<int>(
+                static_cast<long long>(numStates) * block / numBlocks);
+    };
+
+    // Copy the model serially; each block initializes and uses its own copy.
+    std::vector<std::unique_ptr<Model>> models;
+    for (int block = 0; block < numBlocks; ++block) {
+        models.emplace_back(new Model(model));
     }
-    accelTableIMU.setColumnLabels(framePaths);
 
-    return accelTableIMU;
+    // Produce the forces for each state into one ForceBuffer per block.
+    std::vector<std::unique_ptr<ForceBuffer>> buffers(numBlocks);
+    std::vector<std::string> forcePaths;
+    parallelForChunks(numBlocks, [&](int block) {
+        Model& localModel = *models[block];
+        SimTK::State state = localModel.initSystem();
+        std::vector<const ForceProducer*> producers;
+        for (const auto& producer :
+                localModel.getComponentList<ForceProducer>()) {
+            producers.push_back(&producer);
+        }
+        if (block == 0) {
+            for (const auto* producer : producers) {
+                forcePaths.push_back(producer->getAbsolutePathString());
+            }
+        }
+        auto buffer = std::unique_ptr<ForceBuffer>(new ForceBuffer(localModel));
+        for (int itime = blockBegin(block); itime < blockBegin(block + 1);
+                ++itime) {
+            const SimTK::State& source = states[itime];
+            OPENSIM_THROW_IF(source.getNY() != state.getNY(), Exception,
+                    "Expected the states to have {} state variables, but "
+                    "state {} has {}.", state.getNY(), itime, source.getNY());
+            state.setTime(source.getTime());
+            state.updY() = source.getY();
+            localModel.realizeDynamics(state);
+            buffer->beginState();
+            for (int iforce = 0; iforce < (int)producers.size(); ++iforce) {
+                if (!producers[iforce]->appliesForce(state)) continue;
+                buffer->setForceIndex(iforce);
+                producers[iforce]->produceForces(state, *buffer);
+            }
+        }
+        buffers[block] = std::move(buffer);
+    }, numThreads);
+    const std::vector<std::string>& targetPaths =
+            buffers[0]->getTargetPaths();
+
+    // Assign each entry to a slot: (force, kind, target, occurrence).
+    using SlotKey = std::tuple<int, int, int, int>;
+    std::map<SlotKey, int> slotOf;
+    std::vector<SlotKey> slotKeys;
+    std::vector<std::vector<int>> entrySlots(numBlocks);
+    std::map<std::tuple<int, int, int>, int> occurrences;
+    for (int block = 0; block < numBlocks; ++block) {
+        const ForceBuffer& buffer = *buffers[block];
+        const auto& begins = buffer.getStateBegins();
+        entrySlots[block].resize(buffer.getNumEntries());
+        for (int istate = 0; istate < buffer.getNumStates(); ++istate) {
+            const int end = istate + 1 < buffer.getNumStates()
+                                    ? begins[istate + 1]
+                                    : buffer.getNumEntries();
+            occurrences.clear();
+            for (int ientry = begins[istate]; ientry < end; ++ientry) {
+                const int force = buffer.getForceIndices()[ientry];
+                const int kind = static_cast<int>(buffer.getKinds()[ientry]);
+                const int target = buffer.getTargetIndices()[ientry];
+                const int occurrence =
+                        occurrences[std::make_tuple(force, kind, target)]++;
+                const SlotKey key(force, kind, target, occurrence);
+                auto it = slotOf.find(key);
+                if (it == slotOf.end()) {
+                    it = slotOf.emplace(key, (int)slotKeys.size()).first;
+                    slotKeys.push_back(key);
+                }
+                entrySlots[block][ientry] = it->second;
+            }
+        }
+    }
+
+    // Group the columns by force, in the order of the model's forces, and
+    // within a force by first appearance.
+    const int numSlots = static_cast<int>(slotKeys.size());
+    std::vector<int> order(numSlots);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return std::get<0>(slotKeys[a]) < std::get<0>(slotKeys[b]);
+    });
+    static const std::vector<std::string> spatialSuffixes[] = {
+            {"px", "py", "pz", "fx", "fy", "fz"},
+            {"tx", "ty", "tz", "fx", "fy", "fz"}};
+    static const char* kindNames[] = {
+            "point_force", "body_force", "generalized_force"};
+    std::vector<int> slotColumn(numSlots);
+    std::vector<std::string> labels;
+    for (int slot : order) {
+        const int force = std::get<0>(slotKeys[slot]);
+        const int kind = std::get<1>(slotKeys[slot]);
+        const std::string prefix = fmt::format("{}|{}|{}|{}",
+                forcePaths[force], kindNames[kind],
+                targetPaths[std::get<2>(slotKeys[slot])],
+                std::get<3>(slotKeys[slot]));
+        slotColumn[slot] = static_cast<int>(labels.size());
+        if (kind == static_cast<int>(ForceBuffer::Kind::GeneralizedForce)) {
+            labels.push_back(prefix);
+        } else {
+            for (const auto& suffix : spatialSuffixes[kind]) {
+                labels.push_back(prefix + "|" + suffix);
+            }
+        }
+    }
+
+    // Scatter the entries into the (column-major) matrix.
+    SimTK::Matrix data(numStates, static_cast<int>(labels.size()),
+            SimTK::NaN);
+    parallelForChunks(numBlocks, [&](int block) {
+        const ForceBuffer& buffer = *buffers[block];
+        const auto& begins = buffer.getStateBegins();
+        for (int istate = 0; istate < buffer.getNumStates(); ++istate) {
+            const int row = blockBegin(block) + istate;
+            const int end = istate + 1 < buffer.getNumStates()
+                                    ? begins[istate + 1]
+                                    : buffer.getNumEntries();
+            for (int ientry = begins[istate]; ientry < end; ++ientry) {
+                const int column = slotColumn[entrySlots[block][ientry]];
+                const SimTK::SpatialVec& vectors =
+                        buffer.getVectors()[ientry];
+                switch (buffer.getKinds()[ientry]) {
+                case ForceBuffer::Kind::GeneralizedForce:
+                    data(row, column) = vectors[1][0];
+                    break;
+                case ForceBuffer::Kind::PointForce: {
+                    const SimTK::Vec3& point = buffer.getPoints()[ientry];
+                    for (int i = 0; i < 3; ++i) {
+                        data(row, column + i) = point[i];
+                        data(row, column + 3 + i) = vectors[1][i];
+                    }
+                    break;
+                }
+                case ForceBuffer::Kind::BodySpatialVec:
+                    for (int i = 0; i < 3; ++i) {
+                        data(row, column + i) = vectors[0][i];
+                        data(row, column + 3 + i) = vectors[1][i];
+                    }
+                    break;
+                }
+            }
+        }
+    }, numThreads);
+
+    std::vector<double> times(numStates);
+    for (int itime = 0; itime < numStates; ++itime) {
+        times[itime] = states[itime].getTime();
+    }
+    return TimeSeriesTable(times, data, labels);
 }
 
 void OpenSim::appendCoupledCoordinateValues(TimeSeriesTable& table,
@@ -410,10 +410,11 @@ TimeSeriesTable_<T> analyze(Model model, const TimeSeriesTable& statesTable,
 /// the linear accelerations and the resulting accelerations are re-expressed in
 /// the bases of the associated Frame%s.
 ///
-/// @note The linear acceleration Output%s are computed using the analyze()
-/// simulation utility, and therefore the 'statesTable' and 'controlsTable'
-/// arguments must contain the same time points and we assume that the states
-/// obey any kinematic constraints in the Model.
+/// @note The linear accelerations are computed using
+/// createSyntheticIMUSignals(), which realizes the states in the same way as
+/// the analyze() simulation utility, and therefore the 'statesTable' and
+/// 'controlsTable' arguments must contain the same time points and we assume
+/// that the states obey any kinematic constraints in the Model.
 ///
 /// @note The passed in model must have the correct mass and inertia properties
 /// included, since computing accelerations requires realizing to
@@ -425,6 +426,75 @@ OSIMSIMULATION_API TimeSeriesTableVec3 createSyntheticIMUAccelerationSignals(
         const TimeSeriesTable& statesTable, const TimeSeriesTable& controlsTable,
         const std::vector<std::string>& framePaths);
 
+/// The signals of "synthetic" IMUs attached to a set of frames, as computed by
+/// createSyntheticIMUSignals(). Each table has one column per frame, labeled
+/// with the frame's path.
+/// @ingroup simulationutil
+struct SyntheticIMUSignals {
+    /// The orientation of each frame in ground.
+    TimeSeriesTableQuaternion orientations;
+    /// The angular velocity of each frame in ground, expressed in the frame
+    /// (i.e., gyroscope signals).
+    TimeSeriesTableVec3 angularVelocities;
+    /// The linear acceleration of the origin of each frame in ground, minus
+    /// the model's gravitational acceleration, expressed in the frame (i.e.,
+    /// accelerometer signals).
+    TimeSeriesTableVec3 linearAccelerations;
+};
+
+/// Calculate the orientation, gyroscope, and accelerometer signals of
+/// "synthetic" IMUs attached to each frame in 'framePaths', for every row of
+/// 'statesTable'. The signals are the same as those of IMU components attached
+/// to the frames, and 'linearAccelerations' matches
+/// createSyntheticIMUAccelerationSignals().
+///
+/// The rows are split into up to numThreads contiguous blocks (0 means one per
+/// thread of ThreadPool::getDefault()) of at least 32 rows, so short tables
+/// are evaluated serially. Each block is evaluated with its own
+/// copy of the model, and each state is realized once for all frames, so
+/// this is much faster than analyze() for many frames or long trajectories.
+///
+/// The controls table is used to set the model's controls vector, as in
+/// analyze(); controls missing from the table are given a value of 0. The
+/// states and controls tables must contain the same time points, and the
+/// states must obey any kinematic constraints in the Model. SimTK::Motion%s in
+/// the Model (e.g., PositionMotion) are applied.
+///
+/// @ingroup simulationutil
+OSIMSIMULATION_API SyntheticIMUSignals createSyntheticIMUSignals(
+        const Model& model, const TimeSeriesTable& statesTable,
+        const TimeSeriesTable& controlsTable,
+        const std::vector<std::string>& framePaths, int numThreads = 0);
+
+/// Compute the forces produced by each ForceProducer in the model (e.g.,
+/// actuators, ligaments, and ExternalForce%s) for every state in `states`,
+/// and collect them in a table with one group of columns per force. Within a
+/// force's group, each distinct force it produces gets its own columns:
+///   - point forces: `<force>|point_force|<frame>|<k>|px` ... `|pz` hold the
+///     point of application and `|fx` ... `|fz` hold the force, both
+///     expressed in ground;
+///   - body forces and torques: `<force>|body_force|<frame>|<k>|tx` ... `|tz`
+///     hold the torque and `|fx` ... `|fz` hold the force, expressed in
+///     ground;
+///   - generalized forces: `<force>|generalized_force|<coordinate>|<k>`.
+///
+/// Here, `<k>` numbers the forces of the same kind that a force applies to
+/// the same frame or coordinate (e.g., a muscle with two path points on the
+/// same body). A force that is not produced at some states (e.g., at an
+/// inactive conditional path point) is NaN at those states. Forces for
+/// which appliesForce() is false are skipped, as are forces that are not
+/// ForceProducer%s.
+///
+/// The states are split into numThreads contiguous blocks (0 means one per
+/// thread of ThreadPool::getDefault()), each evaluated with its own copy of
+/// the model. Only the time and state variables (Y) of each state are copied
+/// into the model copies, so discrete variables are not transferred. The
+/// states must belong to `model` or to an identical copy of it.
+/// @ingroup simulationutil
+OSIMSIMULATION_API TimeSeriesTable createProducedForcesTable(
+        const Model& model, const StatesTrajectory& states,
+        int numThreads = 0);
+
 /// Compute the values of coordinates defined by `CoordinateCouplerConstraint`s
 /// in the model and append them to the provided `TimeSeriesTable`. The table
 /// should contain columns with values for all the independent coordinates that
@@ -24,10 +24,13 @@
 #include "StatesTrajectory.h"
 
 #include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/Parallel.h>
 #include <OpenSim/Common/Storage.h>
 #include <OpenSim/Common/TableUtilities.h>
 #include <OpenSim/Simulation/Model/Model.h>
 
+#include <algorithm>
+
 using namespace OpenSim;
 
 size_t StatesTrajectory::getSize() const {
@@ -129,36 +132,64 @@ TimeSeriesTable StatesTrajectory::exportToTable(const Model& model,
     OPENSIM_THROW_IF(!isCompatibleWith(model),
                      StatesTrajectory::IncompatibleModel, model);
 
-    // This code is based on DelimFileAdapter::extendRead().
-    TimeSeriesTable table;
-
-    // Set the column labels as metadata.
     std::vector<std::string> stateVars = requestedStateVars.empty() ?
             ::createVector(model.getStateVariableNames()) :
             requestedStateVars;
-    table.setColumnLabels(stateVars);
-    size_t numDepColumns = stateVars.size();
-
-    // Fill up the table with the data.
-    for (size_t itime = 0; itime < getSize(); ++itime) {
-        const auto& state = get(itime);
-        TimeSeriesTable::RowVector row(static_cast<int>(numDepColumns));
-
-        // Get each state variable's value.
-        if (requestedStateVars.empty()) {
-            // This is *much* faster than getting the values one-by-one.
-            row = model.getStateVariableValues(state).transpose();
-        } else {
-            for (unsigned icol = 0; icol < numDepColumns; ++icol) {
-                row[static_cast<int>(icol)] =
-                    model.getStateVariableValue(state, stateVars[icol]);
+    const int numDepColumns = static_cast<int>(stateVars.size());
+    const int numRows = static_cast<int>(getSize());
+
+    // Resolve each state variable to its index in the State's Y vector once,
+    // rather than looking up each variable by name in every state. A state
+    // variable that is not stored directly in Y gets -1 and is looked up by
+    // name instead.
+    const SimTK::State& workingState = model.getWorkingState();
+    const int numY = workingState.getNY();
+    std::vector<int> yIndices(numDepColumns, -1);
+    for (int icol = 0; icol < numDepColumns; ++icol) {
+        const SimTK::SystemYIndex index =
+                model.getStateVariableSystemIndex(workingState, stateVars[icol]);
+        if (index.isValid() && index < numY) yIndices[icol] = index;
+    }
+    for (const auto& state : m_states) {
+        OPENSIM_THROW_IF(state.getNY() != numY,
+                StatesTrajectory::IncompatibleModel, model);
+    }
+
+    // Gather the data into a preallocated matrix. Rows are independent, so
+    // blocks of rows are filled concurrently for long trajectories.
+    std::vector<double> times(numRows);
+    SimTK::Matrix data(numRows, numDepColumns);
+    auto fillRows = [&](int begin, int end) {
+        for (int irow = begin; irow < end; ++irow) {
+            const auto& state = get(irow);
+            const SimTK::Vector& y = state.getY();
+            times[irow] = state.getTime();
+            for (int icol = 0; icol < numDepColumns; ++icol) {
+                if (yIndices[icol] >= 0) data(irow, icol) = y[yIndices[icol]];
             }
         }
-
-        table.appendRow(state.getTime(), row);
+    };
+    // Use one block per thread of the default thread pool, but don't bother
+    // with threads for short trajectories.
+    constexpr int minBlockSize = 2048;
+    const int numBlocks = std::max(1,
+            std::min(ThreadPool::getDefault().getNumThreads(),
+                    numRows / minBlockSize));
+    const int blockSize = (numRows + numBlocks - 1) / numBlocks;
+    parallelForChunks(numBlocks, [&](int iblock) {
+        const int begin = iblock * blockSize;
+        fillRows(begin, std::min(begin + blockSize, numRows));
+    });
+
+    for (int icol = 0; icol < numDepColumns; ++icol) {
+        if (yIndices[icol] >= 0) continue;
+        for (int irow = 0; irow < numRows; ++irow) {
+            data(irow, icol) =
+                    model.getStateVariableValue(get(irow), stateVars[icol]);
+        }
     }
 
-    return table;
+    return TimeSeriesTable(times, data, stateVars);
 }
 
 StatesTrajectory StatesTrajectory::createFromStatesStorage(
@@ -212,10 +243,11 @@ StatesTrajectory StatesTrajectory::createFromStatesTable(
     // Also, assemble the indices of the states that we will actually set in the
     // trajectory.
     std::map<int, int> statesToFillUp;
+    // findStateLabelIndices() will check for pre-4.0 column names.
+    const std::vector<int> stateIndices =
+            TableUtilities::findStateLabelIndices(tableLabels, modelStateNames);
     for (int is = 0; is < modelStateNames.getSize(); ++is) {
-        // getStateIndex() will check for pre-4.0 column names.
-        const int stateIndex = TableUtilities::findStateLabelIndex(
-                tableLabels, modelStateNames[is]);
+        const int stateIndex = stateIndices[is];
         if (stateIndex == -1) {
             missingColumnNames.push_back(modelStateNames[is]);
         } else {
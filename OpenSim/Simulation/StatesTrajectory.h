@@ -284,6 +284,10 @@ public:
      * @throws IncompatibleModel Thrown if the Model fails the check
      *      isCompatibleWith().
      *
+     * The state variables are resolved to their indices in each state once,
+     * and long trajectories are copied into the table using multiple
+     * threads.
+     *
      * See DataAdapter for details on writing to files.
      */
     TimeSeriesTable exportToTable(const Model& model,
@@ -28,9 +28,12 @@
 #include <OpenSim/Simulation/SimbodyEngine/Coordinate.h>
 #include <OpenSim/Simulation/SimbodyEngine/FreeJoint.h>
 #include <OpenSim/Simulation/Model/ForceAdapter.h>
+#include <OpenSim/Simulation/Model/ForceBuffer.h>
 #include <OpenSim/Simulation/Model/ForceConsumer.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/Model/PhysicalFrame.h>
+#include <OpenSim/Simulation/SimulationUtilities.h>
+#include <OpenSim/Simulation/StatesTrajectory.h>
 
 #include <algorithm>
 #include <cstddef>
@@ -444,3 +447,87 @@ TEST_CASE("ForceProducer (ExampleForceProducer)")
         REQUIRE(forceProducerVectors == blankForceVectors);
     }
 }
+
+TEST_CASE("ForceProducer (ForceBuffer and createProducedForcesTable)")
+{
+    Model model;
+    auto* body          = new Body{"body", 1.0, SimTK::Vec3{0.0}, SimTK::Inertia{1.0}};
+    auto* joint         = new FreeJoint{"joint", model.getGround(), *body};
+    auto* forceProducer = new MockForceProducer{*body, joint->get_coordinates(0)};
+    forceProducer->setName("producer");
+    model.addBody(body);
+    model.addJoint(joint);
+    model.addForce(forceProducer);
+    SimTK::State state = model.initSystem();
+
+    // Translate the body along x so that the point forces move in ground.
+    StatesTrajectory states;
+    for (int i = 0; i < 7; ++i) {
+        state.setTime(0.1 * i);
+        joint->get_coordinates(3).setValue(state, 0.5 * i);
+        states.append(state);
+    }
+
+    SECTION("`ForceBuffer` records each produced force in order")
+    {
+        ForceBuffer buffer{model};
+        model.realizeDynamics(states[2]);
+        buffer.beginState();
+        buffer.setForceIndex(0);
+        forceProducer->produceForces(states[2], buffer);
+
+        REQUIRE(buffer.getNumStates() == 1);
+        REQUIRE(buffer.getNumEntries() == 5);
+        CHECK(buffer.getKinds()[2] == ForceBuffer::Kind::BodySpatialVec);
+        CHECK(buffer.getVectors()[2][0] == SimTK::Vec3(0.1, 0.25, 0.5));
+        CHECK(buffer.getKinds()[3] == ForceBuffer::Kind::GeneralizedForce);
+        CHECK(buffer.getVectors()[3][1][0] == 2.0);
+        CHECK(buffer.getTargetPaths()[buffer.getTargetIndices()[3]] ==
+                joint->get_coordinates(0).getAbsolutePathString());
+        CHECK(buffer.getKinds()[4] == ForceBuffer::Kind::PointForce);
+        CHECK(buffer.getPoints()[4][0] == Catch::Approx(2.0));
+
+        buffer.clear();
+        REQUIRE(buffer.getNumEntries() == 0);
+        REQUIRE(buffer.getNumStates() == 0);
+    }
+
+    SECTION("`createProducedForcesTable` has one column group per produced force")
+    {
+        const TimeSeriesTable table = createProducedForcesTable(model, states, 1);
+        REQUIRE(table.getNumRows() == 7);
+        // 3 body forces, 1 generalized force, and 1 point force.
+        REQUIRE(table.getNumColumns() == 3 * 6 + 1 + 6);
+
+        const std::string bodyPrefix = "/forceset/producer|body_force|/bodyset/body|";
+        const auto& torque = table.getDependentColumn(bodyPrefix + "2|tx");
+        const auto& force = table.getDependentColumn(bodyPrefix + "1|fy");
+        const auto& generalized = table.getDependentColumn(
+                "/forceset/producer|generalized_force|" +
+                joint->get_coordinates(0).getAbsolutePathString() + "|0");
+        const auto& px = table.getDependentColumn(
+                "/forceset/producer|point_force|/bodyset/body|0|px");
+        for (int i = 0; i < 7; ++i) {
+            CHECK(torque[i] == 0.1);
+            CHECK(force[i] == -0.25);
+            CHECK(generalized[i] == 2.0);
+            CHECK(px[i] == Catch::Approx(1.0 + 0.5 * i));
+        }
+
+        SECTION("The table does not depend on the number of threads")
+        {
+            const TimeSeriesTable parallel = createProducedForcesTable(model, states, 3);
+            REQUIRE(parallel.getColumnLabels() == table.getColumnLabels());
+            REQUIRE(parallel.getIndependentColumn() == table.getIndependentColumn());
+            CHECK((parallel.getMatrix() - table.getMatrix()).normRMS() == 0);
+        }
+    }
+
+    SECTION("`createProducedForcesTable` skips forces that do not apply forces")
+    {
+        forceProducer->set_appliesForce(false);
+        const TimeSeriesTable table = createProducedForcesTable(model, states);
+        CHECK(table.getNumRows() == 7);
+        CHECK(table.getNumColumns() == 0);
+    }
+}
@@ -421,6 +421,62 @@ TEST_CASE("testPathSpring") {
     osimModel.disownAllComponents();
 }
 
+TEST_CASE("testGeometryPathSpeedMatchesSegmentSpeeds") {
+    // The lengthening speed reuses the segment directions computed with the
+    // path; it should equal the sum of the speeds between consecutive points.
+    Model model("arm26.osim");
+    SimTK::State& state = model.initSystem();
+    int icoord = 0;
+    for (const auto& coord : model.getComponentList<Coordinate>()) {
+        coord.setSpeedValue(state, 0.5 + 0.25 * icoord++);
+    }
+    model.realizeVelocity(state);
+
+    for (const auto& path : model.getComponentList<GeometryPath>()) {
+        const auto& currentPath = path.getCurrentPath(state);
+        double expectedSpeed = 0;
+        for (int i = 0; i < currentPath.getSize() - 1; ++i) {
+            expectedSpeed +=
+                    currentPath[i]->calcSpeedBetween(state, *currentPath[i+1]);
+        }
+        CHECK(path.getLengtheningSpeed(state) ==
+                Catch::Approx(expectedSpeed).margin(1e-12));
+    }
+}
+
+TEST_CASE("testGeometryPathNearlyCoincidentPoints") {
+    // Two consecutive path points that are farther apart than SimTK::Eps but
+    // closer than SimTK::SignificantReal are treated as coincident, without
+    // producing NaN speeds or forces.
+    Model model;
+    auto* block = new OpenSim::Body(
+            "block", 1.0, Vec3(0), SimTK::Inertia::brick(0.1, 0.1, 0.1));
+    auto* slider = new SliderJoint("slider", model.getGround(), *block);
+    model.addBody(block);
+    model.addJoint(slider);
+    auto* spring = new PathSpring("spring", 0.0, 10.0, 0.5);
+    spring->updGeometryPath().appendNewPathPoint(
+            "origin", model.updGround(), Vec3(0));
+    spring->updGeometryPath().appendNewPathPoint(
+            "insertion", *block, Vec3(0));
+    model.addForce(spring);
+
+    SimTK::State& state = model.initSystem();
+    const double distance = 10 * SimTK::Eps;
+    REQUIRE(distance < SimTK::SignificantReal);
+    const Coordinate& coord = slider->getCoordinate();
+    coord.setValue(state, distance);
+    coord.setSpeedValue(state, -0.5);
+    model.realizeAcceleration(state);
+
+    const double length = spring->getLength(state);
+    CHECK(length > SimTK::Eps);
+    CHECK(length < SimTK::SignificantReal);
+    CHECK(spring->getLengtheningSpeed(state) == Catch::Approx(0.5));
+    CHECK(!SimTK::isNaN(spring->getTension(state)));
+    CHECK(!SimTK::isNaN(coord.getAccelerationValue(state)));
+}
+
 TEST_CASE("testSpringMass") {
     using namespace SimTK;
 
@@ -83,6 +83,10 @@ void testUpdateMarkerWeights();
 // weights and marker error is being reduced as its weighting increases.
 void testTrackWithUpdateMarkerWeights();
 
+// Verify that the Gauss-Newton tracking method finds the same solution as
+// the Assembler, including when a clamped coordinate is driven to its bound.
+void testTrackWithGaussNewton();
+
 // Verify that solver does not confuse/mismanage markers when reference
 // has more markers than the model, order is changed or marker reference
 // includes intervals with NaNs (no observation)
@@ -119,6 +123,12 @@ int main()
         failures.push_back("testTrackWithUpdateMarkerWeights");
     }
 
+    try { testTrackWithGaussNewton(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testTrackWithGaussNewton");
+    }
+
     try { testNumberOfMarkersMismatch(); }
     catch (const std::exception& e) {
         cout << e.what() << endl;
@@ -576,6 +586,84 @@ void testTrackWithUpdateMarkerWeights()
     }
 }
 
+void testTrackWithGaussNewton()
+{
+    cout << "\ntestInverseKinematicsSolver::testTrackWithGaussNewton()"
+         << endl;
+    std::unique_ptr<Model> pendulum{ constructPendulumWithMarkers() };
+    Coordinate& coord = pendulum->updCoordinateSet()[0];
+    // The motion below swings past the upper end of this range.
+    coord.setRangeMin(-0.5);
+    coord.setRangeMax(0.5);
+    coord.setDefaultClamped(true);
+
+    SimTK::State state = pendulum->initSystem();
+
+    StatesTrajectory states;
+    double dt = 0.01;
+    for (int i = 0; i < 101; ++i) {
+        state.updTime() = i*dt;
+        coord.setValue(state, SimTK::Pi/3 * sin(SimTK::Pi*i*dt), false);
+        states.append(state);
+    }
+
+    SimTK::RowVector_<SimTK::Vec3> biases(3, SimTK::Vec3(0));
+    std::shared_ptr<MarkersReference> markersRef(
+            new MarkersReference(generateMarkerDataFromModelAndStates(
+                    *pendulum, states, biases, 0.005),
+                    Set<MarkerWeight>()));
+    markersRef->setDefaultWeight(1.0);
+
+    SimTK::Array_<CoordinateReference> coordRefs;
+    coord.setValue(state, 0.0);
+    SimTK::State assemblerState = state;
+    SimTK::State gaussNewtonState = state;
+
+    InverseKinematicsSolver assemblerSolver(*pendulum, markersRef, coordRefs);
+    assemblerSolver.setAccuracy(1e-8);
+    assemblerSolver.assemble(assemblerState);
+
+    InverseKinematicsSolver gaussNewtonSolver(
+            *pendulum, markersRef, coordRefs);
+    gaussNewtonSolver.setAccuracy(1e-8);
+    gaussNewtonSolver.setTrackingMethod(
+            InverseKinematicsSolver::TrackingMethod::GaussNewton);
+    gaussNewtonSolver.assemble(gaussNewtonState);
+
+    SimTK::Array_<double> assemblerErrors, gaussNewtonErrors;
+    bool reachedBound = false;
+    for (unsigned i = 0; i < markersRef->getNumFrames(); ++i) {
+        assemblerState.updTime() = i*dt;
+        gaussNewtonState.updTime() = i*dt;
+        assemblerSolver.track(assemblerState);
+        gaussNewtonSolver.track(gaussNewtonState);
+
+        const double assemblerValue = coord.getValue(assemblerState);
+        const double gaussNewtonValue = coord.getValue(gaussNewtonState);
+        SimTK_ASSERT_ALWAYS(gaussNewtonValue <= coord.getRangeMax() + 1e-10,
+            "Gauss-Newton tracking violated the coordinate's range.");
+        SimTK_ASSERT_ALWAYS(abs(assemblerValue - gaussNewtonValue) < 1e-5,
+            "Gauss-Newton and Assembler tracking found different solutions.");
+        reachedBound = reachedBound ||
+            gaussNewtonValue >= coord.getRangeMax() - 1e-10;
+
+        SimTK_ASSERT_ALWAYS(gaussNewtonSolver.getNumIterationsInLastTrack()
+                < 100, "Gauss-Newton tracking did not converge.");
+
+        // The reported errors come from the Gauss-Newton solution.
+        assemblerSolver.computeCurrentMarkerErrors(assemblerErrors);
+        gaussNewtonSolver.computeCurrentMarkerErrors(gaussNewtonErrors);
+        for (unsigned j = 0; j < assemblerErrors.size(); ++j) {
+            SimTK_ASSERT_ALWAYS(
+                abs(assemblerErrors[j] - gaussNewtonErrors[j]) < 1e-5,
+                "Gauss-Newton and Assembler tracking report different "
+                "marker errors.");
+        }
+    }
+    SimTK_ASSERT_ALWAYS(reachedBound,
+        "Expected the motion to drive the coordinate to its bound.");
+}
+
 void testNumberOfMarkersMismatch()
 {
     cout << 
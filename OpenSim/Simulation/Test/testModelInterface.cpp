@@ -35,6 +35,7 @@ using namespace std;
 void testModelFinalizePropertiesAndConnections();
 void testModelTopologyErrors();
 void testDoesNotSegfaultWithUnusualConnections();
+void testCachedJointReactions();
 
 int main() {
     LoadOpenSimLibrary("osimActuators");
@@ -43,6 +44,7 @@ int main() {
         SimTK_SUBTEST(testModelFinalizePropertiesAndConnections);
         SimTK_SUBTEST(testModelTopologyErrors);
         SimTK_SUBTEST(testDoesNotSegfaultWithUnusualConnections);
+        SimTK_SUBTEST(testCachedJointReactions);
     SimTK_END_TEST();
 }
 
@@ -262,3 +264,45 @@ void testDoesNotSegfaultWithUnusualConnections()
         // a runtime exception (for now... ;))
     }
 }
+
+void testCachedJointReactions()
+{
+    // The cached reactions shared by all Joints must match what Simbody
+    // computes for each mobilizer individually.
+    Model model("double_pendulum.osim");
+    SimTK::State& state = model.initSystem();
+    for (const auto& coord : model.getComponentList<Coordinate>()) {
+        coord.setValue(state, 0.3, false);
+        coord.setSpeedValue(state, -0.7);
+    }
+    model.realizeAcceleration(state);
+
+    for (const auto& joint : model.getComponentList<Joint>()) {
+        const SimTK::MobilizedBody& mobod =
+                joint.getChildFrame().getMobilizedBody();
+        const SimTK::SpatialVec onChild =
+                joint.calcReactionOnChildExpressedInGround(state);
+        const SimTK::SpatialVec onParent =
+                joint.calcReactionOnParentExpressedInGround(state);
+        const SimTK::SpatialVec expectedOnChild =
+                mobod.findMobilizerReactionOnBodyAtMInGround(state);
+        const SimTK::SpatialVec expectedOnParent =
+                mobod.findMobilizerReactionOnParentAtFInGround(state);
+        for (int i = 0; i < 2; ++i) {
+            ASSERT_EQUAL(expectedOnChild[i], onChild[i], 1e-10);
+            ASSERT_EQUAL(expectedOnParent[i], onParent[i], 1e-10);
+        }
+    }
+
+    // Changing the speeds must invalidate the cached reactions.
+    const auto& joint = model.getComponentList<Joint>().begin();
+    const SimTK::SpatialVec before =
+            joint->calcReactionOnChildExpressedInGround(state);
+    for (const auto& coord : model.getComponentList<Coordinate>()) {
+        coord.setSpeedValue(state, 2.0);
+    }
+    model.realizeAcceleration(state);
+    const SimTK::SpatialVec after =
+            joint->calcReactionOnChildExpressedInGround(state);
+    ASSERT((before - after).norm() > SimTK::SignificantReal);
+}
@@ -0,0 +1,118 @@
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  testModelVisualizer.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/ModelVisualizer.h>
+
+#include <catch2/catch_all.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace OpenSim;
+
+namespace {
+    // The geometry drawn for one frame must not depend on whether it came
+    // from a DecorationBuffer or directly from the model.
+    void checkSameGeometry(
+            const SimTK::Array_<SimTK::DecorativeGeometry>& actual,
+            const SimTK::Array_<SimTK::DecorativeGeometry>& expected) {
+        REQUIRE(actual.size() == expected.size());
+        for (unsigned i = 0; i < actual.size(); ++i) {
+            const auto& a = actual[i];
+            const auto& e = expected[i];
+            CHECK(a.getBodyId() == e.getBodyId());
+            CHECK(a.getIndexOnBody() == e.getIndexOnBody());
+            CHECK(a.getRepresentation() == e.getRepresentation());
+            CHECK(a.getOpacity() == e.getOpacity());
+            CHECK(a.getColor() == e.getColor());
+            CHECK(a.getScaleFactors() == e.getScaleFactors());
+            CHECK(a.getTransform().p() == e.getTransform().p());
+            CHECK(a.getTransform().R().asMat33() ==
+                    e.getTransform().R().asMat33());
+        }
+    }
+}
+
+TEST_CASE("DecorationBuffer matches the decorations generated directly") {
+    Model model("arm26.osim");
+    SimTK::State state = model.initSystem();
+    const auto& elbow = model.getCoordinateSet().get("r_elbow_flex");
+
+    // Realize each frame and buffer its decorations, as showMotion() does.
+    const int numFrames = 5;
+    std::vector<SimTK::State> states;
+    std::vector<double> times;
+    for (int i = 0; i < numFrames; ++i) {
+        state.setTime(0.1 * i);
+        elbow.setValue(state, 0.3 * i);
+        states.push_back(state);
+        model.realizeReport(states.back());
+        times.push_back(state.getTime());
+    }
+    auto buffer = std::make_shared<SimTK::DecorationBuffer>(times);
+    for (int i = 0; i < numFrames; ++i) {
+        SimTK::Array_<SimTK::DecorativeGeometry> geometry;
+        model.generateDecorations(
+                false, model.getDisplayHints(), states[i], geometry);
+        buffer->appendFrame(std::move(geometry), model.getDisplayHints());
+    }
+    buffer->close();
+    for (int i = 0; i < numFrames; ++i) CHECK(buffer->waitForFrame(i));
+    CHECK_FALSE(buffer->waitForFrame(numFrames));
+
+    SimTK::DefaultGeometry direct(model);
+    SimTK::DefaultGeometry buffered(model);
+    buffered.setDecorationBuffer(buffer);
+    auto checkAllFrames = [&](bool expectBuffered) {
+        for (int i = 0; i < numFrames; ++i) {
+            CAPTURE(i);
+            SimTK::Array_<SimTK::DecorativeGeometry> expected;
+            direct.generateDecorations(states[i], expected);
+            SimTK::Array_<SimTK::DecorativeGeometry> actual;
+            buffered.generateDecorations(states[i], actual);
+            checkSameGeometry(actual, expected);
+
+            SimTK::Array_<SimTK::DecorativeGeometry> fromBuffer;
+            CHECK(buffer->appendGeometryAtTime(states[i].getTime(),
+                          model.getDisplayHints(), fromBuffer) ==
+                    expectBuffered);
+        }
+    };
+
+    SECTION("Frames are drawn from the buffer") {
+        SimTK::Array_<SimTK::DecorativeGeometry> paths;
+        direct.generateDecorations(states[0], paths);
+        CHECK(!paths.empty());
+        checkAllFrames(true);
+    }
+
+    SECTION("Frames follow the Show menu toggles") {
+        // Toggling the path geometry (as the Show menu does) after the frames
+        // were buffered must still change what is drawn.
+        ModelDisplayHints& hints = model.updDisplayHints();
+        hints.set_show_path_geometry(!hints.get_show_path_geometry());
+        checkAllFrames(false);
+        hints.set_show_path_geometry(!hints.get_show_path_geometry());
+        checkAllFrames(true);
+    }
+}
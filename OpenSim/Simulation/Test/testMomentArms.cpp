@@ -55,6 +55,7 @@ void testMomentArmDefinitionForModel(const string &filename,
                                      double mass = -1.0, string errorMessage = "");
 
 void testMomentArmsAcrossCompoundJoint();
+void testSpeedCouplingMatchesProjection(const string& filename);
 
 int main()
 {
@@ -128,6 +129,10 @@ int main()
 
         testMomentArmDefinitionForModel("CoupledCoordinatesMPPsMomentArmTest.osim", "foot_angle", "vas_int_r", SimTK::Vec2(-2*SimTK::Pi/3, SimTK::Pi/18), -1.0, "Multiple moving path points: FAILED");
         cout << "Multiple moving path points coupled coordinates test: PASSED\n" << endl;
+
+        testSpeedCouplingMatchesProjection("testMomentArmsConstraintB.osim");
+        testSpeedCouplingMatchesProjection("CoupledCoordinatesMPPsMomentArmTest.osim");
+        cout << "Cached constraint coupling matches projection: PASSED\n" << endl;
     }
     catch (const Exception& e) {
         e.print(cerr);
@@ -139,6 +144,43 @@ int main()
     return 0;
 }
 
+// The model's cached speed coupling (used by MomentArmSolver) must match
+// projecting a unit speed of each coordinate onto the constraints.
+void testSpeedCouplingMatchesProjection(const string& filename)
+{
+    Model model(filename);
+    SimTK::State& s = model.initSystem();
+    const auto& coords = model.getCoordinateSet();
+
+    const SimTK::Matrix& coupling = model.getSpeedCouplingMatrix(s);
+    for (int i = 0; i < coords.getSize(); ++i) {
+        const Coordinate& coord = coords[i];
+        if (coord.getLocked(s)) continue;
+
+        SimTK::State sProj = s;
+        sProj.updU() = 0;
+        coord.setSpeedValue(sProj, 1);
+        model.getMultibodySystem().realize(sProj, SimTK::Stage::Velocity);
+        model.getMultibodySystem().projectU(sProj, 1e-10);
+        const double speed = coord.getSpeedValue(sProj);
+        if (std::abs(speed) < SimTK::SignificantReal) continue;
+        SimTK::Vector expected = sProj.getU() / speed;
+
+        // Find the column of this coordinate's speed.
+        SimTK::State sUnit = s;
+        sUnit.updU() = 0;
+        coord.setSpeedValue(sUnit, 1);
+        int iu = 0;
+        while (sUnit.getU()[iu] == 0) ++iu;
+
+        for (int j = 0; j < s.getNU(); ++j) {
+            ASSERT_EQUAL(expected[j], coupling(j, iu), 1e-6, __FILE__,
+                    __LINE__, "Speed coupling differs for coordinate " +
+                    coord.getName());
+        }
+    }
+}
+
 void testMomentArmsAcrossCompoundJoint()
 {
     Model model;
@@ -770,6 +770,50 @@ void testExport() {
             OpenSim::Exception);
 }
 
+void testExportLongTrajectory() {
+    // Long enough that the table is filled in several blocks.
+    Model arm26("arm26.osim");
+    const SimTK::State& s0 = arm26.initSystem();
+    StatesTrajectory states;
+    const int numStates = 10000;
+    for (int itime = 0; itime < numStates; ++itime) {
+        SimTK::State state = s0;
+        state.setTime(0.001 * itime);
+        for (int iy = 0; iy < state.getNY(); ++iy) {
+            state.updY()[iy] = 0.01 * itime + iy;
+        }
+        states.append(state);
+    }
+
+    auto table = states.exportToTable(arm26);
+    SimTK_TEST((int)table.getNumRows() == numStates);
+    tableAndTrajectoryMatch(arm26, table, states);
+
+    // Every state variable of arm26 (coordinates and muscle states) is
+    // stored directly in Y.
+    const SimTK::State& last = states[numStates - 1];
+    const auto allNames = arm26.getStateVariableNames();
+    for (int isv = 0; isv < allNames.getSize(); ++isv) {
+        const std::string& name = allNames[isv];
+        const SimTK::SystemYIndex index =
+                arm26.getStateVariableSystemIndex(s0, name);
+        SimTK_TEST(index.isValid());
+        SimTK_TEST(last.getY()[index] ==
+                   arm26.getStateVariableValue(last, name));
+    }
+
+    // Relative state variable names are resolved as before.
+    const auto stateNames = arm26.getStateVariableNames();
+    const std::string relativeName = stateNames[1].substr(1);
+    auto subset = states.exportToTable(arm26, {relativeName, stateNames[0]});
+    SimTK_TEST(subset.getColumnLabels()[0] == relativeName);
+    const auto& column = subset.getDependentColumnAtIndex(0);
+    for (int itime = 0; itime < numStates; itime += 997) {
+        SimTK_TEST(column[itime] ==
+                   arm26.getStateVariableValue(states[itime], relativeName));
+    }
+}
+
 int main() {
     SimTK_START_TEST("testStatesTrajectory");
         // actuators library is not loaded automatically (unless using clang).
@@ -802,6 +846,7 @@ int main() {
 
         // Export to data table.
         SimTK_SUBTEST(testExport);
+        SimTK_SUBTEST(testExportLongTrajectory);
 
     SimTK_END_TEST();
 }
@@ -34,6 +34,11 @@
 #include <OpenSim/Simulation/SimbodyEngine/FreeJoint.h>
 #include <OpenSim/Simulation/StatesTrajectory.h>
 
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+
 using namespace std;
 using namespace OpenSim;
 using namespace SimTK;
@@ -70,7 +75,8 @@ void VisualizerUtilities::showModel(Model model) {
 }
 
 // Based on code from simtk.org/projects/predictivesim SimbiconExample/main.cpp.
-void VisualizerUtilities::showMotion(Model model, TimeSeriesTable statesTable) {
+void VisualizerUtilities::showMotion(Model model, TimeSeriesTable statesTable,
+        bool decimateToFrameRate) {
 
     const SimTK::Real initialTime = statesTable.getIndependentColumn().front();
     const SimTK::Real finalTime = statesTable.getIndependentColumn().back();
@@ -79,9 +85,11 @@ void VisualizerUtilities::showMotion(Model model, TimeSeriesTable statesTable) {
     // A data rate of 300 Hz means we can maintain 30 fps down to
     // realTimeScale = 0.1. But if we have more than 20 seconds of data, then
     // we lower the data rate to avoid using too much memory.
-    const double desiredNumStates = std::min(300 * duration, 300.0 * 20.0);
-    const double dataRate = desiredNumStates / duration; // Hz
     const double frameRate = 30;                         // Hz.
+    const double desiredNumStates = decimateToFrameRate
+            ? frameRate * duration
+            : std::min(300 * duration, 300.0 * 20.0);
+    const double dataRate = desiredNumStates / duration; // Hz
 
     // Prepare data.
     // -------------
@@ -101,11 +109,60 @@ void VisualizerUtilities::showMotion(Model model, TimeSeriesTable statesTable) {
     model.setUseVisualizer(true);
     model.initSystem();
 
-    // This line allows muscle activity to be visualized. To get muscle activity
-    // we probably need to realize only to Dynamics, but realizing to Report
-    // will catch any other calculations that custom components require for
+    // Realize the states and generate their dynamic geometry (e.g., wrapped
+    // muscle paths) on a background thread, ahead of playback. The
+    // visualizer then draws frames from this buffer rather than asking every
+    // component to generate decorations during playback, so that playback
+    // speed is limited by rendering rather than by the model. Realizing to
+    // Report (rather than Dynamics, which is needed for muscle activity)
+    // catches any other calculations that custom components require for
     // visualizing.
-    for (const auto& state : statesTraj) { model.realizeReport(state); }
+    std::vector<double> times;
+    times.reserve(numStates);
+    for (const auto& state : statesTraj) { times.push_back(state.getTime()); }
+    auto decorations = std::make_shared<SimTK::DecorationBuffer>(times);
+    model.updVisualizer().getGeometryDecorationGenerator()
+            ->setDecorationBuffer(decorations);
+    std::atomic<bool> stopGenerating{false};
+    std::exception_ptr generationError;
+    std::thread generator([&]() {
+        try {
+            for (const auto& state : statesTraj) {
+                if (stopGenerating) break;
+                SimTK::Array_<SimTK::DecorativeGeometry> geometry;
+                // Sample the "Show" menu toggles for each frame; frames drawn
+                // after the toggles change are regenerated by the visualizer.
+                const ModelDisplayHints hints = model.getDisplayHints();
+                {
+                    const auto lock = decorations->lockModel();
+                    model.realizeReport(state);
+                    model.generateDecorations(false, hints, state, geometry);
+                }
+                decorations->appendFrame(std::move(geometry), hints);
+            }
+        } catch (...) {
+            generationError = std::current_exception();
+        }
+        decorations->close();
+    });
+    // Stop and join the generator however we leave this function, and
+    // rethrow any error it encountered.
+    auto finishGenerating = [&]() {
+        stopGenerating = true;
+        if (generator.joinable()) generator.join();
+        if (generationError) std::rethrow_exception(generationError);
+    };
+    auto waitForFrame = [&](int frame) {
+        if (!decorations->waitForFrame(frame)) finishGenerating();
+    };
+    struct GeneratorJoiner {
+        std::atomic<bool>& stop;
+        std::thread& thread;
+        ~GeneratorJoiner() {
+            stop = true;
+            if (thread.joinable()) thread.join();
+        }
+    } generatorJoiner{stopGenerating, generator};
 
     // Set up visualization.
     // ---------------------
@@ -187,6 +244,7 @@ void VisualizerUtilities::showMotion(Model model, TimeSeriesTable statesTable) {
                 istate = (int)SimTK::clamp(0, desiredIndex, numStates - 1);
                 // Allow the user to drag this slider to visualize different
                 // times.
+                waitForFrame(istate);
                 viz.drawFrameNow(statesTraj[istate]);
             } else {
                 log_cout("Internal error: unrecognized slider.");
@@ -199,6 +257,7 @@ void VisualizerUtilities::showMotion(Model model, TimeSeriesTable statesTable) {
             // Exit.
             if (key == SimTK::Visualizer::InputListener::KeyEsc) {
                 log_cout("Exiting visualization.");
+                finishGenerating();
                 return;
             }
             // Smart zoom.
@@ -212,6 +271,7 @@ void VisualizerUtilities::showMotion(Model model, TimeSeriesTable statesTable) {
                         viz.updDecoration(pausedIndex));
                 text.setText(paused ? "Paused (hit Space to resume)" : "");
                 // Show the updated text.
+                waitForFrame(istate);
                 viz.drawFrameNow(statesTraj[istate]);
             }
         }
@@ -223,6 +283,7 @@ void VisualizerUtilities::showMotion(Model model, TimeSeriesTable statesTable) {
         if (paused) {
             std::this_thread::sleep_for(std::chrono::milliseconds(5));
         } else {
+            waitForFrame(istate);
             viz.report(statesTraj[istate]);
             ++istate;
         }
@@ -38,7 +38,16 @@ public:
     /// coordinates. The visualizer window allows the user to control playback
     /// speed. This function blocks until the user exits the simbody-visualizer
     /// window.
-    static void showMotion(Model, TimeSeriesTable);
+    ///
+    /// The dynamic geometry of each frame (e.g., muscle paths) is computed on
+    /// a background thread ahead of playback, so playback can begin before
+    /// all frames are computed and its speed is limited by rendering rather
+    /// than by the model. If `decimateToFrameRate` is true, the motion is
+    /// resampled at the display frame rate (30 Hz) rather than at up to
+    /// 300 Hz, which reduces precomputation time and memory for long motions
+    /// at the expense of smoothness when playback is slowed down.
+    static void showMotion(Model, TimeSeriesTable,
+            bool decimateToFrameRate = false);
     /// @}
 
     ///  Visualize the passed in model in a simbody-visualizer window.
@@ -31,6 +31,7 @@
 #include "Model/Force.h"
 #include "Model/ForceAdapter.h"
 #include "Model/ForceApplier.h"
+#include "Model/ForceBuffer.h"
 #include "Model/ForceConsumer.h"
 #include "Model/ForceProducer.h"
 #include "Model/ForceSet.h"
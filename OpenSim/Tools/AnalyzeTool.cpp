@@ -23,6 +23,7 @@
 #include "AnalyzeTool.h"
 #include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/MemoryInstrumentation.h>
 
 #include <OpenSim/Simulation/Control/ControlLinear.h>
 #include <OpenSim/Simulation/Control/ControlSet.h>
@@ -525,6 +526,7 @@ bool AnalyzeTool::run()
 }
 bool AnalyzeTool::run(bool plotting)
 {
+    MemoryScope memoryScope("AnalyzeTool");
     //cout<<"Running analyze tool "<<getName()<<"."<<endl;
 
     // CHECK FOR A MODEL
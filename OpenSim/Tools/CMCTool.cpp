@@ -28,6 +28,7 @@
 #include "VectorFunctionForActuators.h"
 #include <OpenSim/Common/Assertion.h>
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/MemoryInstrumentation.h>
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
@@ -384,6 +385,7 @@ operator=(const CMCTool &aTool)
  */
 bool CMCTool::run()
 {
+    MemoryScope memoryScope("CMCTool");
     log_info("Running tool '{}'.", getName());
 
     // CHECK FOR A MODEL
@@ -0,0 +1,79 @@
+#ifndef OPENSIM_IK_TRIAL_H_
+#define OPENSIM_IK_TRIAL_H_
+/* -------------------------------------------------------------------------- *
+ *                            OpenSim:  IKTrial.h                             *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimToolsDLL.h"
+#include "IKTaskSet.h"
+
+namespace OpenSim {
+
+//=============================================================================
+//=============================================================================
+/**
+ * One trial to be solved by the InverseKinematicsTool when it is given an
+ * IKTrialSet. The name of the trial is used to label its output files. The
+ * remaining settings (model, constraint weight, accuracy, error reporting,
+ * results directory) are taken from the tool.
+ */
+class OSIMTOOLS_API IKTrial : public Object {
+    OpenSim_DECLARE_CONCRETE_OBJECT(IKTrial, Object);
+
+public:
+    OpenSim_DECLARE_PROPERTY(marker_file, std::string,
+            "TRC file (.trc) containing the marker observations for this "
+            "trial.");
+    OpenSim_DECLARE_PROPERTY(coordinate_file, std::string,
+            "Storage (.sto or .mot) file containing coordinate observations "
+            "for this trial (optional).");
+    OpenSim_DECLARE_LIST_PROPERTY_SIZE(time_range, double, 2,
+            "The time range for this trial. Default: the full range of the "
+            "marker data.");
+    OpenSim_DECLARE_PROPERTY(output_motion_file, std::string,
+            "Name of the resulting motion (.mot) file. Default: "
+            "<trial name>_ik.mot in the tool's results directory.");
+    OpenSim_DECLARE_OPTIONAL_PROPERTY(task_set, IKTaskSet,
+            "Task weights for this trial. If omitted, the tool's IKTaskSet "
+            "is used.");
+
+    IKTrial() { constructProperties(); }
+    IKTrial(const std::string& name, const std::string& markerFile) {
+        constructProperties();
+        setName(name);
+        set_marker_file(markerFile);
+    }
+
+private:
+    void constructProperties() {
+        constructProperty_marker_file("");
+        constructProperty_coordinate_file("");
+        Array<double> range{SimTK::Infinity, 2};
+        range[0] = -SimTK::Infinity;
+        constructProperty_time_range(range);
+        constructProperty_output_motion_file("");
+        constructProperty_task_set();
+    }
+};
+
+} // end of namespace OpenSim
+
+#endif // OPENSIM_IK_TRIAL_H_
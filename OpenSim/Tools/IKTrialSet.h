@@ -0,0 +1,48 @@
+#ifndef OPENSIM_IK_TRIAL_SET_H_
+#define OPENSIM_IK_TRIAL_SET_H_
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  IKTrialSet.h                            *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2024 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimToolsDLL.h"
+#include "IKTrial.h"
+#include <OpenSim/Common/Set.h>
+
+namespace OpenSim {
+
+//=============================================================================
+//=============================================================================
+/**
+ * A set of IKTrial%s. When an InverseKinematicsTool has a non-empty
+ * IKTrialSet, it solves all of the trials (concurrently) with one model
+ * instead of solving the tool's own marker_file.
+ */
+class OSIMTOOLS_API IKTrialSet : public Set<IKTrial> {
+    OpenSim_DECLARE_CONCRETE_OBJECT(IKTrialSet, Set<IKTrial>);
+
+public:
+    IKTrialSet() {}
+    IKTrialSet(const std::string& fileName) : Set<IKTrial>(fileName) {}
+};
+
+} // end of namespace OpenSim
+
+#endif // OPENSIM_IK_TRIAL_SET_H_
@@ -30,6 +30,7 @@
 #include <OpenSim/Common/FunctionSet.h>
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/MemoryInstrumentation.h>
 #include <OpenSim/Common/Stopwatch.h>
 #include <OpenSim/Common/XMLDocument.h>
 #include <OpenSim/Simulation/InverseDynamicsSolver.h>
@@ -242,6 +243,7 @@ void InverseDynamicsTool::getJointsByName(Model &model, const Array<std::string>
  */
 bool InverseDynamicsTool::run()
 {
+    MemoryScope memoryScope("InverseDynamicsTool");
     bool success = false;
     bool modelFromFile=true;
     try{
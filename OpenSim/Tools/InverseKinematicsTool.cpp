@@ -34,16 +34,87 @@
 #include <OpenSim/Common/FunctionSet.h>
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/MemoryInstrumentation.h>
+#include <OpenSim/Common/Parallel.h>
 #include <OpenSim/Common/Stopwatch.h>
 #include <OpenSim/Common/Storage.h>
 #include <OpenSim/Common/XMLDocument.h>
 #include <OpenSim/Simulation/InverseKinematicsSolver.h>
 #include <OpenSim/Simulation/Model/Model.h>
 
+#include <algorithm>
+#include <atomic>
+
 using namespace OpenSim;
 using namespace std;
 using namespace SimTK;
 
+namespace {
+// Create the references for one set of tasks and data files. This is used both
+// for the tool's own settings (populateReferences()) and for each IKTrial.
+void populateReferencesForTasks(const Model& model, const IKTaskSet& tasks,
+    const std::string& markerFile, const std::string& coordinateFile,
+    MarkersReference& markersReference,
+    SimTK::Array_<CoordinateReference>&coordinateReferences)
+{
+    // Load the coordinate data
+    std::unique_ptr<FunctionSet> coordFunctions;
+    if (coordinateFile != "" && coordinateFile != "Unassigned") {
+        Storage coordinateValues(coordinateFile);
+        // Convert degrees to radian (TODO: this needs to have a check that the storage is, in fact, in degrees!)
+        model.getSimbodyEngine().convertDegreesToRadians(coordinateValues);
+        coordFunctions.reset(new GCVSplineSet(5, &coordinateValues));
+    }
+
+    Set<MarkerWeight> markerWeights;
+    // Loop through old "IKTaskSet" and assign weights to the coordinate and marker references
+    // For coordinates, create the functions for coordinate reference values
+    int index = 0;
+    for (int i = 0; i < tasks.getSize(); i++) {
+        if (!tasks[i].getApply()) continue;
+        if (IKCoordinateTask *coordTask = dynamic_cast<IKCoordinateTask *>(&tasks[i])) {
+            // CoordinateReference copies the reference function.
+            std::unique_ptr<CoordinateReference> coordRef;
+            if (coordTask->getValueType() == IKCoordinateTask::FromFile) {
+                if (!coordFunctions)
+                    throw OpenSim::Exception("InverseKinematicsTool: value for coordinate " + coordTask->getName() + " not found.");
+
+                index = coordFunctions->getIndex(coordTask->getName(), index);
+                if (index >= 0) {
+                    coordRef.reset(new CoordinateReference(coordTask->getName(), coordFunctions->get(index)));
+                }
+            }
+            else if ((coordTask->getValueType() == IKCoordinateTask::ManualValue)) {
+                Constant reference(Constant(coordTask->getValue()));
+                coordRef.reset(new CoordinateReference(coordTask->getName(), reference));
+            }
+            else { // assume it should be held at its default value
+                double value = model.getCoordinateSet().get(coordTask->getName()).getDefaultValue();
+                Constant reference = Constant(value);
+                coordRef.reset(new CoordinateReference(coordTask->getName(), reference));
+            }
+
+            if (coordRef == nullptr)
+                throw OpenSim::Exception("InverseKinematicsTool: value for coordinate " + coordTask->getName() + " not found.");
+            else
+                coordRef->setWeight(coordTask->getWeight());
+
+            coordinateReferences.push_back(*coordRef);
+        }
+        else if (IKMarkerTask *markerTask = dynamic_cast<IKMarkerTask *>(&tasks[i])) {
+            // Only track markers that have a task and it is "applied"
+            markerWeights.adoptAndAppend(
+                new MarkerWeight(markerTask->getName(), markerTask->getWeight()));
+        }
+    }
+
+    //Read in the marker data file and set the weights for associated markers.
+    //Markers in the model and the marker file but not in the markerWeights are
+    //ignored
+    markersReference.initializeFromMarkersFile(markerFile, markerWeights);
+}
+}
+
 //=============================================================================
 // CONSTRUCTOR(S) AND DESTRUCTOR
 //=============================================================================
@@ -86,6 +157,9 @@ void InverseKinematicsTool::constructProperties()
     constructProperty_marker_file("");
     constructProperty_coordinate_file("");
     constructProperty_report_marker_locations(false);
+    constructProperty_IKTrialSet(IKTrialSet());
+    constructProperty_num_parallel_threads(0);
+    constructProperty_use_gauss_newton_tracking(false);
 }
 
 //=============================================================================
@@ -102,6 +176,9 @@ void InverseKinematicsTool::constructProperties()
  */
 bool InverseKinematicsTool::run()
 {
+    MemoryScope memoryScope("InverseKinematicsTool");
+    if (get_IKTrialSet().getSize() > 0) return runTrials();
+
     bool success = false;
     bool modelFromFile=true;
     std::unique_ptr<Kinematics> kinematicsReporter(new Kinematics());
@@ -169,6 +246,10 @@ bool InverseKinematicsTool::run()
         InverseKinematicsSolver ikSolver(*_model, make_shared<MarkersReference>(markersReference),
             coordinateReferences, get_constraint_weight());
         ikSolver.setAccuracy(get_accuracy());
+        if (get_use_gauss_newton_tracking()) {
+            ikSolver.setTrackingMethod(
+                    InverseKinematicsSolver::TrackingMethod::GaussNewton);
+        }
         s.updTime() = times[start_ix];
         ikSolver.assemble(s);
         kinematicsReporter->begin(s);
@@ -312,6 +393,220 @@ bool InverseKinematicsTool::run()
     return success;
 }
 
+//_____________________________________________________________________________
+/**
+ * Solve all trials in the IKTrialSet. The model is loaded once and copied for
+ * each thread; trials are handed out to the threads as they become free.
+ */
+bool InverseKinematicsTool::runTrials()
+{
+    std::unique_ptr<Model> modelFromFile;
+    if (_model.empty()) {
+        OPENSIM_THROW_IF_FRMOBJ(get_model_file().empty(), Exception,
+                "No model filename was provided.");
+        modelFromFile.reset(new Model(get_model_file()));
+    }
+    Model& model = modelFromFile ? *modelFromFile : *_model;
+    model.finalizeFromProperties();
+    model.printBasicInfo();
+
+    auto cwd = IO::CwdChanger::changeToParentOf(getDocumentFileName());
+
+    const IKTrialSet& trials = get_IKTrialSet();
+    const int numTrials = trials.getSize();
+    OPENSIM_THROW_IF_FRMOBJ(get_num_parallel_threads() < 0, Exception,
+            "Expected 'num_parallel_threads' to be non-negative, but received "
+            "{}.", get_num_parallel_threads());
+    const int requestedThreads = get_num_parallel_threads() > 0
+            ? get_num_parallel_threads()
+            : ThreadPool::getDefault().getNumThreads();
+    const int numThreads = std::max(1, std::min(requestedThreads, numTrials));
+    log_info("Running tool {} for {} trials on {} threads.", getName(),
+            numTrials, numThreads);
+    IO::makeDir(getResultsDir());
+
+    // Each thread gets its own copy of the model, with its System built up
+    // front.
+    struct Worker {
+        std::unique_ptr<Model> model;
+        SimTK::State defaultState;
+    };
+    std::vector<Worker> workers(numThreads);
+    for (auto& worker : workers) {
+        worker.model.reset(model.clone());
+        worker.defaultState = worker.model->initSystem();
+    }
+
+    struct TrialResult {
+        int numFrames = 0;
+        double solveTime = 0;
+        double meanRMSError = 0;
+        double maxError = 0;
+        std::string failure;
+    };
+    std::vector<TrialResult> results(numTrials);
+
+    auto solveTrial = [&](Worker& worker, const IKTrial& trial,
+                              TrialResult& result) {
+        Model& localModel = *worker.model;
+        SimTK::State s = worker.defaultState;
+        const std::string& trialName = trial.getName();
+
+        const IKTaskSet& tasks = trial.getProperty_task_set().empty()
+                                         ? get_IKTaskSet()
+                                         : trial.get_task_set();
+        MarkersReference markersReference;
+        SimTK::Array_<CoordinateReference> coordinateReferences;
+        populateReferencesForTasks(localModel, tasks, trial.get_marker_file(),
+                trial.get_coordinate_file(), markersReference,
+                coordinateReferences);
+
+        SimTK::Vec2 markersValidTimeRange =
+                markersReference.getValidTimeRange();
+        double start_time = std::max(markersValidTimeRange[0],
+                trial.get_time_range(0));
+        double final_time = std::min(markersValidTimeRange[1],
+                trial.get_time_range(1));
+        OPENSIM_THROW_IF(final_time < start_time, Exception,
+                "Trial '{}': final time ({}) is before start time ({}).",
+                trialName, final_time, start_time);
+
+        const auto& markersTable = markersReference.getMarkerTable();
+        const int start_ix = int(
+            markersTable.getNearestRowIndexForTime(start_time) );
+        const int final_ix = int(
+            markersTable.getNearestRowIndexForTime(final_time) );
+        const int Nframes = final_ix - start_ix + 1;
+        const auto& times = markersTable.getIndependentColumn();
+
+        InverseKinematicsSolver ikSolver(localModel,
+                make_shared<MarkersReference>(markersReference),
+                coordinateReferences, get_constraint_weight());
+        ikSolver.setAccuracy(get_accuracy());
+        if (get_use_gauss_newton_tracking()) {
+            ikSolver.setTrackingMethod(
+                    InverseKinematicsSolver::TrackingMethod::GaussNewton);
+        }
+        s.updTime() = times[start_ix];
+        ikSolver.assemble(s);
+
+        Kinematics kinematics;
+        kinematics.setRecordAccelerations(false);
+        kinematics.setInDegrees(true);
+        kinematics.setModel(localModel);
+        kinematics.begin(s);
+
+        int nm = ikSolver.getNumMarkersInUse();
+        SimTK::Array_<double> squaredMarkerErrors(nm, 0.0);
+        std::unique_ptr<Storage> modelMarkerErrors(get_report_errors() ?
+                new Storage(Nframes, "ModelMarkerErrors") : nullptr);
+
+        Stopwatch watch;
+        double sumRMS = 0;
+        for (int i = start_ix; i <= final_ix; ++i) {
+            s.updTime() = times[i];
+            ikSolver.track(s);
+
+            ikSolver.computeCurrentSquaredMarkerErrors(squaredMarkerErrors);
+            double totalSquaredMarkerError = 0.0;
+            double maxSquaredMarkerError = 0.0;
+            for (int j = 0; j < nm; ++j) {
+                totalSquaredMarkerError += squaredMarkerErrors[j];
+                maxSquaredMarkerError =
+                        std::max(maxSquaredMarkerError, squaredMarkerErrors[j]);
+            }
+            double rms = nm > 0 ? sqrt(totalSquaredMarkerError / nm) : 0;
+            sumRMS += rms;
+            result.maxError =
+                    std::max(result.maxError, sqrt(maxSquaredMarkerError));
+            if (modelMarkerErrors) {
+                Array<double> markerErrors(0.0, 3);
+                markerErrors.set(0, totalSquaredMarkerError);
+                markerErrors.set(1, rms);
+                markerErrors.set(2, sqrt(maxSquaredMarkerError));
+                modelMarkerErrors->append(s.getTime(), 3, &markerErrors[0]);
+            }
+
+            kinematics.step(s, i);
+        }
+        result.solveTime = watch.getElapsedTime();
+        result.numFrames = Nframes;
+        result.meanRMSError = sumRMS / Nframes;
+
+        std::string motionFile = trial.get_output_motion_file();
+        if (motionFile.empty()) {
+            motionFile = getResultsDir() + "/" + trialName + "_ik.mot";
+        }
+        kinematics.getPositionStorage()->print(motionFile);
+
+        if (modelMarkerErrors) {
+            Array<string> labels("", 4);
+            labels[0] = "time";
+            labels[1] = "total_squared_error";
+            labels[2] = "marker_error_RMS";
+            labels[3] = "marker_error_max";
+            modelMarkerErrors->setColumnLabels(labels);
+            modelMarkerErrors->setName("Model Marker Errors from IK");
+            Storage::printResult(modelMarkerErrors.get(),
+                    trialName + "_ik_marker_errors", getResultsDir(), -1,
+                    ".sto");
+        }
+    };
+
+    Stopwatch watch;
+    std::atomic<int> nextTrial(0);
+    auto work = [&](Worker& worker) {
+        for (int itrial = nextTrial++; itrial < numTrials;
+                itrial = nextTrial++) {
+            const IKTrial& trial = trials.get(itrial);
+            try {
+                solveTrial(worker, trial, results[itrial]);
+                log_info("Trial '{}': solved {} frames in {:.3f} s.",
+                        trial.getName(), results[itrial].numFrames,
+                        results[itrial].solveTime);
+            } catch (const std::exception& ex) {
+                results[itrial].failure = ex.what();
+                log_error("Trial '{}' failed: {}", trial.getName(), ex.what());
+            }
+        }
+    };
+    // Each chunk is one worker, which solves trials until none are left.
+    parallelForChunks(numThreads,
+            [&](int iworker) { work(workers[iworker]); }, numThreads);
+
+    // Summarize.
+    int numFailed = 0;
+    int totalFrames = 0;
+    double totalSolveTime = 0;
+    double maxError = 0;
+    log_info("{:<30} {:>8} {:>10} {:>14} {:>14}", "trial", "frames",
+            "time (s)", "mean RMS err", "max err");
+    for (int itrial = 0; itrial < numTrials; ++itrial) {
+        const auto& result = results[itrial];
+        const std::string& name = trials.get(itrial).getName();
+        if (!result.failure.empty()) {
+            ++numFailed;
+            log_info("{:<30} {:>8}", name, "FAILED");
+            continue;
+        }
+        totalFrames += result.numFrames;
+        totalSolveTime += result.solveTime;
+        maxError = std::max(maxError, result.maxError);
+        log_info("{:<30} {:>8} {:>10.3f} {:>14.6f} {:>14.6f}", name,
+                result.numFrames, result.solveTime, result.meanRMSError,
+                result.maxError);
+    }
+    log_info("InverseKinematicsTool solved {} of {} trials ({} frames, "
+             "{:.3f} s of solver time) in {}; max marker error = {}.",
+            numTrials - numFailed, numTrials, totalFrames, totalSolveTime,
+            watch.getElapsedTimeFormatted(), maxError);
+
+    OPENSIM_THROW_IF_FRMOBJ(numFailed > 0, Exception,
+            "{} of {} trials failed; see the log for details.", numFailed,
+            numTrials);
+    return true;
+}
+
 // Handle conversion from older format
 void InverseKinematicsTool::updateFromXMLNode(SimTK::Xml::Element& aNode, int versionNumber)
 {
@@ -404,64 +699,8 @@ void InverseKinematicsTool::updateFromXMLNode(SimTK::Xml::Element& aNode, int ve
 void InverseKinematicsTool::populateReferences(MarkersReference& markersReference,
     SimTK::Array_<CoordinateReference>&coordinateReferences) const
 {
-    FunctionSet *coordFunctions = NULL;
-    // Load the coordinate data
-    // bool haveCoordinateFile = false;
-    if (get_coordinate_file() != "" && get_coordinate_file() != "Unassigned") {
-        Storage coordinateValues(get_coordinate_file());
-        // Convert degrees to radian (TODO: this needs to have a check that the storage is, in fact, in degrees!)
-        _model->getSimbodyEngine().convertDegreesToRadians(coordinateValues);
-        // haveCoordinateFile = true;
-        coordFunctions = new GCVSplineSet(5, &coordinateValues);
-    }
-
-    Set<MarkerWeight> markerWeights;
-    // Loop through old "IKTaskSet" and assign weights to the coordinate and marker references
-    // For coordinates, create the functions for coordinate reference values
-    int index = 0;
-    for (int i = 0; i < get_IKTaskSet().getSize(); i++) {
-        if (!get_IKTaskSet()[i].getApply()) continue;
-        if (IKCoordinateTask *coordTask = dynamic_cast<IKCoordinateTask *>(&get_IKTaskSet()[i])) {
-            CoordinateReference *coordRef = NULL;
-            if (coordTask->getValueType() == IKCoordinateTask::FromFile) {
-                if (!coordFunctions)
-                    throw Exception("InverseKinematicsTool: value for coordinate " + coordTask->getName() + " not found.");
-
-                index = coordFunctions->getIndex(coordTask->getName(), index);
-                if (index >= 0) {
-                    coordRef = new CoordinateReference(coordTask->getName(), coordFunctions->get(index));
-                }
-            }
-            else if ((coordTask->getValueType() == IKCoordinateTask::ManualValue)) {
-                Constant reference(Constant(coordTask->getValue()));
-                coordRef = new CoordinateReference(coordTask->getName(), reference);
-            }
-            else { // assume it should be held at its default value
-                double value = _model->getCoordinateSet().get(coordTask->getName()).getDefaultValue();
-                Constant reference = Constant(value);
-                coordRef = new CoordinateReference(coordTask->getName(), reference);
-            }
-
-            if (coordRef == NULL)
-                throw Exception("InverseKinematicsTool: value for coordinate " + coordTask->getName() + " not found.");
-            else
-                coordRef->setWeight(coordTask->getWeight());
-
-            coordinateReferences.push_back(*coordRef);
-        }
-        else if (IKMarkerTask *markerTask = dynamic_cast<IKMarkerTask *>(&get_IKTaskSet()[i])) {
-            if (markerTask->getApply()) {
-                // Only track markers that have a task and it is "applied"
-                markerWeights.adoptAndAppend(
-                    new MarkerWeight(markerTask->getName(), markerTask->getWeight()));
-            }
-        }
-    }
-
-    //Read in the marker data file and set the weights for associated markers.
-    //Markers in the model and the marker file but not in the markerWeights are
-    //ignored
-    markersReference.initializeFromMarkersFile(get_marker_file(), markerWeights);
+    populateReferencesForTasks(*_model, get_IKTaskSet(), get_marker_file(),
+            get_coordinate_file(), markersReference, coordinateReferences);
 }
 
 
@@ -26,6 +26,7 @@
 #include "osimToolsDLL.h"
 #include <OpenSim/Common/Object.h>
 #include <OpenSim/Tools/IKTaskSet.h>
+#include <OpenSim/Tools/IKTrialSet.h>
 #include <OpenSim/Tools/InverseKinematicsToolBase.h>
 
 namespace OpenSim {
@@ -71,6 +72,23 @@ public:
             "Flag indicating whether or not to report model marker locations. "
             "Note, model marker locations are expressed in Ground.");
 
+    OpenSim_DECLARE_UNNAMED_PROPERTY(IKTrialSet,
+            "Trials to solve with the same model, each with its own marker "
+            "file, coordinate file, time range and (optionally) task weights. "
+            "If any trials are provided, marker_file, coordinate_file, "
+            "time_range and output_motion_file are ignored.");
+
+    OpenSim_DECLARE_PROPERTY(num_parallel_threads, int,
+            "The number of threads used to solve the trials in the IKTrialSet "
+            "concurrently. The default, 0, uses the number of threads of the "
+            "default thread pool (the number of available hardware threads, "
+            "unless configured otherwise).");
+
+    OpenSim_DECLARE_PROPERTY(use_gauss_newton_tracking, bool,
+            "Flag indicating whether to solve frames after the first with "
+            "damped Gauss-Newton steps instead of the SimTK::Assembler "
+            "(default: false). See InverseKinematicsSolver::TrackingMethod.");
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -102,6 +120,8 @@ public:
 
     IKTaskSet& getIKTaskSet() { return upd_IKTaskSet(); }
 
+    IKTrialSet& getIKTrialSet() { return upd_IKTrialSet(); }
+
     //--------------------------------------------------------------------------
     // INTERFACE
     //--------------------------------------------------------------------------
@@ -120,6 +140,9 @@ public:
 private:
     void constructProperties();
 
+    // Solve each trial in the IKTrialSet, sharing the loaded model.
+    bool runTrials();
+
     //=============================================================================
 };  // END of class InverseKinematicsTool
 //=============================================================================
@@ -41,6 +41,7 @@
 #include "IKCoordinateTask.h"
 #include "IKMarkerTask.h"
 #include "IKTaskSet.h"
+#include "IKTrialSet.h"
 #include "MarkerPair.h"
 #include "MarkerPairSet.h"
 #include "MarkerPlacer.h"
@@ -84,6 +85,8 @@ OSIMTOOLS_API void RegisterTypes_osimTools()
     Object::registerType( IKCoordinateTask() );
     Object::registerType( IKMarkerTask() );
     Object::registerType( IKTaskSet() );
+    Object::registerType( IKTrial() );
+    Object::registerType( IKTrialSet() );
     Object::registerType( MarkerPair() );
     Object::registerType( MarkerPairSet() );
     Object::registerType( MarkerPlacer() );
@@ -511,4 +511,144 @@ TEST_CASE("Marking controls as invalid") {
             CHECK(newControls[1] == tau1);
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("ControlSet compact table format") {
+    // The x_nodes are read by ControlLinear's direct XML parser.
+    ControlSet controls("arm26_controls.xml");
+    REQUIRE(controls.getSize(false) == 8);
+    const auto& first = dynamic_cast<const ControlLinear&>(controls.get(0));
+    CHECK(first.getName() == "TRIlong.excitation");
+    CHECK(first.getUseSteps());
+    CHECK(first.getDefaultParameterMin() == 0.02);
+    REQUIRE(first.getControlValues().getSize() > 2);
+    CHECK(first.getControlValues()[0]->getTime() == 0.03);
+    CHECK(first.getControlValues()[0]->getValue() == 0.022);
+    CHECK(first.getControlMinValues().getSize() == 0);
+
+    // Exercise min and max nodes and non-default settings.
+    auto& edited = dynamic_cast<ControlLinear&>(controls.get(1));
+    edited.setControlValueMin(0.5, 0.1);
+    edited.setControlValueMax(0.25, 0.9);
+    edited.setKp(12.5);
+    edited.setFilterOn(true);
+
+    const TimeSeriesTable table = controls.exportToTable();
+    STOFileAdapter::write(table, "testControllers_compact_controls.sto");
+    const ControlSet roundTrip(
+            TimeSeriesTable("testControllers_compact_controls.sto"));
+
+    REQUIRE(roundTrip.getName() == controls.getName());
+    REQUIRE(roundTrip.getSize(false) == controls.getSize(false));
+    for (int i = 0; i < controls.getSize(false); ++i) {
+        const auto& expected =
+                dynamic_cast<const ControlLinear&>(controls.get(i));
+        const auto& actual =
+                dynamic_cast<const ControlLinear&>(roundTrip.get(i));
+        CAPTURE(expected.getName());
+        CHECK(actual.getName() == expected.getName());
+        CHECK(actual.getIsModelControl() == expected.getIsModelControl());
+        CHECK(actual.getExtrapolate() == expected.getExtrapolate());
+        CHECK(actual.getFilterOn() == expected.getFilterOn());
+        CHECK(actual.getUseSteps() == expected.getUseSteps());
+        CHECK(actual.getDefaultParameterMin() ==
+                expected.getDefaultParameterMin());
+        CHECK(actual.getDefaultParameterMax() ==
+                expected.getDefaultParameterMax());
+        CHECK(actual.getKp() == expected.getKp());
+        CHECK(actual.getKv() == expected.getKv());
+        auto checkNodes = [](const ArrayPtrs<ControlLinearNode>& a,
+                                  const ArrayPtrs<ControlLinearNode>& b) {
+            REQUIRE(a.getSize() == b.getSize());
+            for (int j = 0; j < a.getSize(); ++j) {
+                CHECK(a[j]->getTime() == b[j]->getTime());
+                CHECK(a[j]->getValue() == b[j]->getValue());
+            }
+        };
+        checkNodes(actual.getControlValues(), expected.getControlValues());
+        checkNodes(actual.getControlMinValues(),
+                expected.getControlMinValues());
+        checkNodes(actual.getControlMaxValues(),
+                expected.getControlMaxValues());
+    }
+}
+
+TEST_CASE("ControlLinear direct XML parsing matches generic deserialization") {
+    // The node lists are in a nonstandard order, with settings between them.
+    const std::string xml =
+            "<ControlLinear name=\"muscle.excitation\">"
+            "<max_nodes><ControlLinearNode><t>0.5</t><value>0.9</value>"
+            "</ControlLinearNode></max_nodes>"
+            "<use_steps>true</use_steps>"
+            "<x_nodes><ControlLinearNode><t>0</t><value>0.1</value>"
+            "</ControlLinearNode><ControlLinearNode><t>1</t><value>0.3</value>"
+            "</ControlLinearNode></x_nodes>"
+            "<kp>12.5</kp>"
+            "<min_nodes><ControlLinearNode><t>0.25</t><value>0.05</value>"
+            "</ControlLinearNode><ControlLinearNode><value>0.02</value>"
+            "</ControlLinearNode></min_nodes>"
+            "</ControlLinear>";
+    const int version = XMLDocument::getLatestVersion();
+    SimTK::Xml::Document document;
+    document.readFromString(xml);
+    SimTK::Xml::Element element = document.getRootElement();
+    SimTK::String original;
+    element.writeToString(original);
+
+    ControlLinear fast;
+    static_cast<Object&>(fast).updateFromXMLNode(element, version);
+    // The element is left as it was, including the order of its children.
+    SimTK::String afterFast;
+    element.writeToString(afterFast);
+    CHECK(afterFast == original);
+
+    ControlLinear generic;
+    static_cast<Object&>(generic).Object::updateFromXMLNode(element, version);
+
+    CHECK(fast.getName() == generic.getName());
+    CHECK(fast.getUseSteps() == generic.getUseSteps());
+    CHECK(fast.getUseSteps());
+    CHECK(fast.getKp() == generic.getKp());
+    CHECK(fast.getKv() == generic.getKv());
+    auto checkNodes = [](const ArrayPtrs<ControlLinearNode>& a,
+                              const ArrayPtrs<ControlLinearNode>& b) {
+        REQUIRE(a.getSize() == b.getSize());
+        for (int j = 0; j < a.getSize(); ++j) {
+            CHECK(a[j]->getTime() == b[j]->getTime());
+            CHECK(a[j]->getValue() == b[j]->getValue());
+        }
+    };
+    CHECK(fast.getControlValues().getSize() == 2);
+    checkNodes(fast.getControlValues(), generic.getControlValues());
+    checkNodes(fast.getControlMinValues(), generic.getControlMinValues());
+    checkNodes(fast.getControlMaxValues(), generic.getControlMaxValues());
+
+    // A whole ControlSet file gives the same controls either way.
+    ControlSet controls("arm26_controls.xml");
+    SimTK::Xml::Document setDocument("arm26_controls.xml");
+    const int setVersion = setDocument.getRootElement()
+            .getRequiredAttributeValueAs<int>("Version");
+    SimTK::Xml::Element setElement =
+            *setDocument.getRootElement().element_begin("ControlSet");
+    SimTK::Xml::Element objectsElement =
+            *setElement.element_begin("objects");
+    int i = 0;
+    for (auto it = objectsElement.element_begin("ControlLinear");
+            it != objectsElement.element_end(); ++it, ++i) {
+        REQUIRE(i < controls.getSize(false));
+        const auto& expected =
+                dynamic_cast<const ControlLinear&>(controls.get(i));
+        ControlLinear actual;
+        static_cast<Object&>(actual).Object::updateFromXMLNode(
+                *it, setVersion);
+        CAPTURE(expected.getName());
+        CHECK(actual.getName() == expected.getName());
+        CHECK(actual.getUseSteps() == expected.getUseSteps());
+        checkNodes(actual.getControlValues(), expected.getControlValues());
+        checkNodes(actual.getControlMinValues(),
+                expected.getControlMinValues());
+        checkNodes(actual.getControlMaxValues(),
+                expected.getControlMaxValues());
+    }
+    CHECK(i == controls.getSize(false));
+}
@@ -37,6 +37,7 @@
 #include "IKCoordinateTask.h"
 #include "IKMarkerTask.h"
 #include "IKTaskSet.h"
+#include "IKTrialSet.h"
 #include "MarkerPair.h"
 #include "MarkerPairSet.h"
 #include "MarkerPlacer.h"